@@ -0,0 +1,222 @@
+#ifndef S21_PARALLEL_H_
+#define S21_PARALLEL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#include "../concurrent/s21_thread_pool.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// Execution policies for the algorithms below. seq runs the <algorithm>
+// version on the calling thread; par splits the range across a thread_pool,
+// thread_pool::instance() unless another one is given with on().
+struct sequenced_policy {};
+
+struct parallel_policy {
+  thread_pool* pool = nullptr;
+
+  constexpr parallel_policy on(thread_pool& other) const noexcept { return parallel_policy{&other}; }
+  thread_pool& executor() const { return pool ? *pool : thread_pool::instance(); }
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+
+template <typename Policy>
+concept execution_policy =
+  std::is_same_v<std::remove_cvref_t<Policy>, sequenced_policy> ||
+  std::is_same_v<std::remove_cvref_t<Policy>, parallel_policy>;
+
+namespace parallel_details {
+// Ranges shorter than this are not worth handing to another thread.
+inline constexpr std::size_t k_min_chunk = 4096;
+
+// Number of chunks [first, first + count) is split into, 1 for sequential runs.
+template <typename Policy>
+std::size_t chunk_count(const Policy& policy, std::size_t count) {
+  if constexpr (std::is_same_v<std::remove_cvref_t<Policy>, parallel_policy>) {
+    std::size_t by_size = (count + k_min_chunk - 1) / k_min_chunk;
+    return std::max<std::size_t>(1, std::min(policy.executor().concurrency(), by_size));
+  } else {
+    (void)policy;
+    (void)count;
+    return 1;
+  }
+}
+
+// Offset of chunk index out of chunks over count elements.
+inline std::ptrdiff_t chunk_begin(std::size_t index, std::size_t chunks, std::size_t count) noexcept {
+  return static_cast<std::ptrdiff_t>(count / chunks * index + std::min(index, count % chunks));
+}
+
+// Calls task(i) for every i in [0, count), on the policy's pool for par.
+template <typename Policy, typename Task>
+void run_tasks(const Policy& policy, std::size_t count, const Task& task) {
+  if constexpr (std::is_same_v<std::remove_cvref_t<Policy>, parallel_policy>) {
+    policy.executor().parallel_for(count, task);
+  } else {
+    (void)policy;
+    for (std::size_t i = 0; i < count; ++i) {
+      task(i);
+    }
+  }
+}
+
+// Calls fn(chunk, begin, end) for every chunk, with begin and end offsets.
+template <typename Policy, typename Fn>
+void for_each_chunk(const Policy& policy, std::size_t chunks, std::size_t count, const Fn& fn) {
+  run_tasks(policy, chunks, [&](std::size_t index) {
+    fn(index, chunk_begin(index, chunks, count), chunk_begin(index + 1, chunks, count));
+  });
+}
+
+// Folds every chunk with op, starting from its first element.
+template <typename T, typename Policy, typename It, typename BinaryOp>
+s21::vector<T> chunk_sums(const Policy& policy, std::size_t chunks, It first, std::size_t count,
+                          const T& fill, BinaryOp op) {
+  s21::vector<T> sums(chunks, fill);
+  for_each_chunk(policy, chunks, count, [&](std::size_t index, std::ptrdiff_t begin, std::ptrdiff_t end) {
+    It it = first + begin;
+    T acc = *it;
+    for (It last = first + end; ++it != last;) {
+      acc = op(std::move(acc), *it);
+    }
+    sums[index] = std::move(acc);
+  });
+  return sums;
+}
+} // namespace parallel_details
+
+// Parallel counterparts of the <algorithm> and <numeric> functions for
+// random access ranges such as s21::vector and s21::array. With par the
+// range is cut into one contiguous chunk per pool thread; ranges of a few
+// thousand elements run on the calling thread.
+template <execution_policy Policy, std::random_access_iterator It, typename Fn>
+void for_each(Policy&& policy, It first, It last, Fn fn) {
+  auto count = static_cast<std::size_t>(last - first);
+  std::size_t chunks = parallel_details::chunk_count(policy, count);
+  parallel_details::for_each_chunk(policy, chunks, count,
+    [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+      std::for_each(first + begin, first + end, fn);
+    });
+}
+
+template <execution_policy Policy, std::random_access_iterator It,
+          std::random_access_iterator OutIt, typename UnaryOp>
+OutIt transform(Policy&& policy, It first, It last, OutIt d_first, UnaryOp op) {
+  auto count = static_cast<std::size_t>(last - first);
+  std::size_t chunks = parallel_details::chunk_count(policy, count);
+  parallel_details::for_each_chunk(policy, chunks, count,
+    [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+      std::transform(first + begin, first + end, d_first + begin, op);
+    });
+  return d_first + static_cast<std::ptrdiff_t>(count);
+}
+
+template <execution_policy Policy, std::random_access_iterator It1, std::random_access_iterator It2,
+          std::random_access_iterator OutIt, typename BinaryOp>
+OutIt transform(Policy&& policy, It1 first1, It1 last1, It2 first2, OutIt d_first, BinaryOp op) {
+  auto count = static_cast<std::size_t>(last1 - first1);
+  std::size_t chunks = parallel_details::chunk_count(policy, count);
+  parallel_details::for_each_chunk(policy, chunks, count,
+    [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+      std::transform(first1 + begin, first1 + end, first2 + begin, d_first + begin, op);
+    });
+  return d_first + static_cast<std::ptrdiff_t>(count);
+}
+
+// op must be associative and commutative: chunks are folded separately and
+// their results combined in order with init.
+template <execution_policy Policy, std::random_access_iterator It, typename T,
+          typename BinaryOp = std::plus<>>
+T reduce(Policy&& policy, It first, It last, T init, BinaryOp op = BinaryOp()) {
+  auto count = static_cast<std::size_t>(last - first);
+  std::size_t chunks = parallel_details::chunk_count(policy, count);
+  if (chunks == 1) {
+    return std::reduce(first, last, std::move(init), op);
+  }
+  auto sums = parallel_details::chunk_sums<T>(policy, chunks, first, count, init, op);
+  for (auto& sum : sums) {
+    init = op(std::move(init), std::move(sum));
+  }
+  return init;
+}
+
+template <execution_policy Policy, std::random_access_iterator It>
+std::iter_value_t<It> reduce(Policy&& policy, It first, It last) {
+  return s21::reduce(policy, first, last, std::iter_value_t<It>());
+}
+
+// Three passes: chunk sums in parallel, their prefix sums on the caller,
+// then each chunk scanned from its prefix in parallel. op must be
+// associative. d_first may equal first.
+template <execution_policy Policy, std::random_access_iterator It,
+          std::random_access_iterator OutIt, typename BinaryOp, typename T>
+OutIt inclusive_scan(Policy&& policy, It first, It last, OutIt d_first, BinaryOp op, T init) {
+  auto count = static_cast<std::size_t>(last - first);
+  std::size_t chunks = parallel_details::chunk_count(policy, count);
+  if (chunks == 1) {
+    return std::inclusive_scan(first, last, d_first, op, std::move(init));
+  }
+  auto carries = parallel_details::chunk_sums<T>(policy, chunks, first, count, init, op);
+  for (auto& carry : carries) {
+    T sum = std::move(carry);
+    carry = init;
+    init = op(std::move(init), std::move(sum));
+  }
+  parallel_details::for_each_chunk(policy, chunks, count,
+    [&](std::size_t index, std::ptrdiff_t begin, std::ptrdiff_t end) {
+      std::inclusive_scan(first + begin, first + end, d_first + begin, op, carries[index]);
+    });
+  return d_first + static_cast<std::ptrdiff_t>(count);
+}
+
+template <execution_policy Policy, std::random_access_iterator It,
+          std::random_access_iterator OutIt, typename BinaryOp = std::plus<>>
+OutIt inclusive_scan(Policy&& policy, It first, It last, OutIt d_first, BinaryOp op = BinaryOp()) {
+  if (first == last) {
+    return d_first;
+  }
+  // The first element seeds the scan, the rest is scanned from it.
+  std::iter_value_t<It> init = *first;
+  *d_first = init;
+  return s21::inclusive_scan(policy, first + 1, last, d_first + 1, op, std::move(init));
+}
+
+// Sorts one chunk per pool thread, then merges neighbouring runs pairwise
+// in parallel rounds. Not stable.
+template <execution_policy Policy, std::random_access_iterator It, typename Compare = std::less<>>
+void sort(Policy&& policy, It first, It last, Compare comp = Compare()) {
+  auto count = static_cast<std::size_t>(last - first);
+  std::size_t chunks = parallel_details::chunk_count(policy, count);
+  if (chunks == 1) {
+    std::sort(first, last, comp);
+    return;
+  }
+  parallel_details::for_each_chunk(policy, chunks, count,
+    [&](std::size_t, std::ptrdiff_t begin, std::ptrdiff_t end) {
+      std::sort(first + begin, first + end, comp);
+    });
+  for (std::size_t width = 1; width < chunks; width *= 2) {
+    std::size_t merges = (chunks + 2 * width - 1) / (2 * width);
+    parallel_details::run_tasks(policy, merges, [&](std::size_t merge) {
+      std::size_t low = merge * 2 * width;
+      std::size_t mid = std::min(low + width, chunks);
+      std::size_t high = std::min(low + 2 * width, chunks);
+      if (mid != high) {
+        std::inplace_merge(first + parallel_details::chunk_begin(low, chunks, count),
+                           first + parallel_details::chunk_begin(mid, chunks, count),
+                           first + parallel_details::chunk_begin(high, chunks, count), comp);
+      }
+    });
+  }
+}
+} // namespace s21
+
+#endif // S21_PARALLEL_H_
@@ -0,0 +1,334 @@
+#ifndef S21_SIMD_H_
+#define S21_SIMD_H_
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+namespace simd_details {
+// Instruction sets the kernels are built for, in increasing order.
+enum class isa { scalar, sse2, avx2 };
+
+inline isa detect_isa() noexcept {
+#if S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return isa::avx2;
+  }
+  if (__builtin_cpu_supports("sse2")) {
+    return isa::sse2;
+  }
+#endif
+  return isa::scalar;
+}
+
+// The best instruction set of the running CPU, detected once.
+inline isa active_isa() noexcept {
+  static const isa k_isa = detect_isa();
+  return k_isa;
+}
+
+// Element types with vector kernels; other arithmetic types use the
+// scalar <algorithm> versions.
+template <typename T>
+inline constexpr bool k_vectorized =
+  std::is_same_v<T, std::int32_t> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+template <typename T>
+struct sse2_ops;
+template <typename T>
+struct avx2_ops;
+
+#if S21_SIMD_X86
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+template <>
+struct sse2_ops<std::int32_t> {
+  using reg = __m128i;
+  static constexpr std::size_t k_width = 4;
+
+  static reg load(const std::int32_t* ptr) { return _mm_loadu_si128(reinterpret_cast<const reg*>(ptr)); }
+  static void store(std::int32_t* ptr, reg val) { _mm_storeu_si128(reinterpret_cast<reg*>(ptr), val); }
+  static reg set1(std::int32_t val) { return _mm_set1_epi32(val); }
+  static unsigned equal_mask(reg lhs, reg rhs) {
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lhs, rhs)));
+  }
+  static reg add(reg lhs, reg rhs) { return _mm_add_epi32(lhs, rhs); }
+  static reg min(reg lhs, reg rhs) { return select(_mm_cmplt_epi32(lhs, rhs), lhs, rhs); }
+  static reg max(reg lhs, reg rhs) { return select(_mm_cmpgt_epi32(lhs, rhs), lhs, rhs); }
+  static reg unordered(reg) { return _mm_setzero_si128(); }
+  static reg bit_or(reg lhs, reg rhs) { return _mm_or_si128(lhs, rhs); }
+  static bool any(reg val) { return _mm_movemask_epi8(val) != 0; }
+
+ private:
+  // SSE2 has no 32-bit integer min/max, so blend through the compare mask.
+  static reg select(reg mask, reg lhs, reg rhs) {
+    return _mm_or_si128(_mm_and_si128(mask, lhs), _mm_andnot_si128(mask, rhs));
+  }
+};
+
+template <>
+struct sse2_ops<float> {
+  using reg = __m128;
+  static constexpr std::size_t k_width = 4;
+
+  static reg load(const float* ptr) { return _mm_loadu_ps(ptr); }
+  static void store(float* ptr, reg val) { _mm_storeu_ps(ptr, val); }
+  static reg set1(float val) { return _mm_set1_ps(val); }
+  static unsigned equal_mask(reg lhs, reg rhs) { return _mm_movemask_ps(_mm_cmpeq_ps(lhs, rhs)); }
+  static reg add(reg lhs, reg rhs) { return _mm_add_ps(lhs, rhs); }
+  static reg min(reg lhs, reg rhs) { return _mm_min_ps(lhs, rhs); }
+  static reg max(reg lhs, reg rhs) { return _mm_max_ps(lhs, rhs); }
+  static reg unordered(reg val) { return _mm_cmpunord_ps(val, val); }
+  static reg bit_or(reg lhs, reg rhs) { return _mm_or_ps(lhs, rhs); }
+  static bool any(reg val) { return _mm_movemask_ps(val) != 0; }
+};
+
+template <>
+struct sse2_ops<double> {
+  using reg = __m128d;
+  static constexpr std::size_t k_width = 2;
+
+  static reg load(const double* ptr) { return _mm_loadu_pd(ptr); }
+  static void store(double* ptr, reg val) { _mm_storeu_pd(ptr, val); }
+  static reg set1(double val) { return _mm_set1_pd(val); }
+  static unsigned equal_mask(reg lhs, reg rhs) { return _mm_movemask_pd(_mm_cmpeq_pd(lhs, rhs)); }
+  static reg add(reg lhs, reg rhs) { return _mm_add_pd(lhs, rhs); }
+  static reg min(reg lhs, reg rhs) { return _mm_min_pd(lhs, rhs); }
+  static reg max(reg lhs, reg rhs) { return _mm_max_pd(lhs, rhs); }
+  static reg unordered(reg val) { return _mm_cmpunord_pd(val, val); }
+  static reg bit_or(reg lhs, reg rhs) { return _mm_or_pd(lhs, rhs); }
+  static bool any(reg val) { return _mm_movemask_pd(val) != 0; }
+};
+
+namespace sse2 {
+template <typename T>
+using ops = sse2_ops<T>;
+#include "s21_simd_kernels.inc"
+} // namespace sse2
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC pop_options
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+template <>
+struct avx2_ops<std::int32_t> {
+  using reg = __m256i;
+  static constexpr std::size_t k_width = 8;
+
+  static reg load(const std::int32_t* ptr) { return _mm256_loadu_si256(reinterpret_cast<const reg*>(ptr)); }
+  static void store(std::int32_t* ptr, reg val) { _mm256_storeu_si256(reinterpret_cast<reg*>(ptr), val); }
+  static reg set1(std::int32_t val) { return _mm256_set1_epi32(val); }
+  static unsigned equal_mask(reg lhs, reg rhs) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(lhs, rhs)));
+  }
+  static reg add(reg lhs, reg rhs) { return _mm256_add_epi32(lhs, rhs); }
+  static reg min(reg lhs, reg rhs) { return _mm256_min_epi32(lhs, rhs); }
+  static reg max(reg lhs, reg rhs) { return _mm256_max_epi32(lhs, rhs); }
+  static reg unordered(reg) { return _mm256_setzero_si256(); }
+  static reg bit_or(reg lhs, reg rhs) { return _mm256_or_si256(lhs, rhs); }
+  static bool any(reg val) { return !_mm256_testz_si256(val, val); }
+};
+
+template <>
+struct avx2_ops<float> {
+  using reg = __m256;
+  static constexpr std::size_t k_width = 8;
+
+  static reg load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+  static void store(float* ptr, reg val) { _mm256_storeu_ps(ptr, val); }
+  static reg set1(float val) { return _mm256_set1_ps(val); }
+  static unsigned equal_mask(reg lhs, reg rhs) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ));
+  }
+  static reg add(reg lhs, reg rhs) { return _mm256_add_ps(lhs, rhs); }
+  static reg min(reg lhs, reg rhs) { return _mm256_min_ps(lhs, rhs); }
+  static reg max(reg lhs, reg rhs) { return _mm256_max_ps(lhs, rhs); }
+  static reg unordered(reg val) { return _mm256_cmp_ps(val, val, _CMP_UNORD_Q); }
+  static reg bit_or(reg lhs, reg rhs) { return _mm256_or_ps(lhs, rhs); }
+  static bool any(reg val) { return _mm256_movemask_ps(val) != 0; }
+};
+
+template <>
+struct avx2_ops<double> {
+  using reg = __m256d;
+  static constexpr std::size_t k_width = 4;
+
+  static reg load(const double* ptr) { return _mm256_loadu_pd(ptr); }
+  static void store(double* ptr, reg val) { _mm256_storeu_pd(ptr, val); }
+  static reg set1(double val) { return _mm256_set1_pd(val); }
+  static unsigned equal_mask(reg lhs, reg rhs) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ));
+  }
+  static reg add(reg lhs, reg rhs) { return _mm256_add_pd(lhs, rhs); }
+  static reg min(reg lhs, reg rhs) { return _mm256_min_pd(lhs, rhs); }
+  static reg max(reg lhs, reg rhs) { return _mm256_max_pd(lhs, rhs); }
+  static reg unordered(reg val) { return _mm256_cmp_pd(val, val, _CMP_UNORD_Q); }
+  static reg bit_or(reg lhs, reg rhs) { return _mm256_or_pd(lhs, rhs); }
+  static bool any(reg val) { return _mm256_movemask_pd(val) != 0; }
+};
+
+namespace avx2 {
+template <typename T>
+using ops = avx2_ops<T>;
+#include "s21_simd_kernels.inc"
+} // namespace avx2
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+#endif // S21_SIMD_X86
+
+// Entry points taking an explicit instruction set, which must be supported
+// by the running CPU. The public functions below pass active_isa().
+template <typename T>
+std::size_t find_index(const T* data, std::size_t count, T value, isa level) noexcept {
+#if S21_SIMD_X86
+  if constexpr (k_vectorized<T>) {
+    if (level == isa::avx2) {
+      return avx2::find_index(data, count, value);
+    }
+    if (level == isa::sse2) {
+      return sse2::find_index(data, count, value);
+    }
+  }
+#endif
+  (void)level;
+  return static_cast<std::size_t>(std::find(data, data + count, value) - data);
+}
+
+template <typename T>
+std::size_t count_equal(const T* data, std::size_t count, T value, isa level) noexcept {
+#if S21_SIMD_X86
+  if constexpr (k_vectorized<T>) {
+    if (level == isa::avx2) {
+      return avx2::count_equal(data, count, value);
+    }
+    if (level == isa::sse2) {
+      return sse2::count_equal(data, count, value);
+    }
+  }
+#endif
+  (void)level;
+  return static_cast<std::size_t>(std::count(data, data + count, value));
+}
+
+template <typename T>
+T sum(const T* data, std::size_t count, isa level) noexcept {
+#if S21_SIMD_X86
+  if constexpr (k_vectorized<T>) {
+    if (level == isa::avx2) {
+      return avx2::sum(data, count);
+    }
+    if (level == isa::sse2) {
+      return sse2::sum(data, count);
+    }
+  }
+#endif
+  (void)level;
+  return std::accumulate(data, data + count, T());
+}
+
+// Index of the first smallest (or, with Max, largest) element, matching
+// std::min_element/std::max_element. The vector kernels find the extreme
+// value and a second, early-exiting pass finds its first position.
+template <bool Max, typename T>
+std::size_t extreme_index(const T* data, std::size_t count, isa level) noexcept {
+  if (count == 0) {
+    return 0;
+  }
+#if S21_SIMD_X86
+  if constexpr (k_vectorized<T>) {
+    T value = T();
+    bool found = false;
+    if (level == isa::avx2) {
+      found = avx2::extreme_value<Max>(data, count, value);
+    } else if (level == isa::sse2) {
+      found = sse2::extreme_value<Max>(data, count, value);
+    }
+    if (found) {
+      return find_index(data, count, value, level);
+    }
+  }
+#endif
+  (void)level;
+  const T* result = Max ? std::max_element(data, data + count) : std::min_element(data, data + count);
+  return static_cast<std::size_t>(result - data);
+}
+} // namespace simd_details
+
+// Contiguous containers of arithmetic values, such as s21::vector<int> and
+// s21::array<float, N>.
+template <typename Container>
+concept contiguous_arithmetic = std::is_arithmetic_v<typename Container::value_type> &&
+  requires(Container& cont) {
+    { cont.data() } -> std::convertible_to<const typename Container::value_type*>;
+    { cont.size() } -> std::convertible_to<std::size_t>;
+    cont.begin();
+  };
+
+// Vectorized linear scans over data(). The instruction set (AVX2, SSE2 or
+// scalar) is picked at runtime from the running CPU.
+template <contiguous_arithmetic Container>
+auto find(Container& cont, typename Container::value_type value) {
+  return cont.begin() +
+    simd_details::find_index(cont.data(), cont.size(), value, simd_details::active_isa());
+}
+
+template <contiguous_arithmetic Container>
+bool contains(Container& cont, typename Container::value_type value) {
+  return simd_details::find_index(cont.data(), cont.size(), value, simd_details::active_isa()) !=
+    cont.size();
+}
+
+template <contiguous_arithmetic Container>
+std::size_t count(Container& cont, typename Container::value_type value) {
+  return simd_details::count_equal(cont.data(), cont.size(), value, simd_details::active_isa());
+}
+
+// Returns begin() + the first smallest element, or end() when empty.
+template <contiguous_arithmetic Container>
+auto min_element(Container& cont) {
+  return cont.begin() +
+    simd_details::extreme_index<false>(cont.data(), cont.size(), simd_details::active_isa());
+}
+
+template <contiguous_arithmetic Container>
+auto max_element(Container& cont) {
+  return cont.begin() +
+    simd_details::extreme_index<true>(cont.data(), cont.size(), simd_details::active_isa());
+}
+
+// Floating point sums are reassociated across lanes and may differ from a
+// sequential sum in the last bits.
+template <contiguous_arithmetic Container>
+typename Container::value_type sum(Container& cont) {
+  return simd_details::sum(cont.data(), cont.size(), simd_details::active_isa());
+}
+} // namespace s21
+
+#endif // S21_SIMD_H_
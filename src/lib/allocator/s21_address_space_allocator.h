@@ -0,0 +1,108 @@
+#ifndef S21_ADDRESS_SPACE_ALLOCATOR_H_
+#define S21_ADDRESS_SPACE_ALLOCATOR_H_
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace s21 {
+// Allocator that reserves reserve_bytes of address space (PROT_NONE) per
+// allocation and commits only the pages in use. Blocks grow and shrink in
+// place through reallocate_in_place, so a vector using it never moves its
+// elements. Growing past the reservation throws std::length_error.
+template <typename T>
+class address_space_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  static constexpr size_type k_default_reserve = size_type(1) << 34;  // 16 GiB
+
+  explicit address_space_allocator(size_type reserve_bytes = k_default_reserve) noexcept
+    : reserve_bytes_(round_up(reserve_bytes)) {}
+  template <typename U>
+  address_space_allocator(const address_space_allocator<U>& other) noexcept
+    : reserve_bytes_(other.reserve_bytes()) {}
+
+  [[nodiscard]] T* allocate(size_type count) {
+    check_reservation(count);
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+    void* ptr = mmap(nullptr, reserve_bytes_, PROT_NONE, flags, -1, 0);
+    if (ptr == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    try {
+      commit(static_cast<char*>(ptr), 0, round_up(count * sizeof(T)));
+    } catch (...) {
+      munmap(ptr, reserve_bytes_);
+      throw;
+    }
+    return static_cast<T*>(ptr);
+  }
+
+  void deallocate(T* ptr, size_type) noexcept {
+    munmap(static_cast<void*>(ptr), reserve_bytes_);
+  }
+
+  // Commits or releases pages so that new_count elements are accessible.
+  bool reallocate_in_place(T* ptr, size_type old_count, size_type new_count) {
+    check_reservation(new_count);
+    size_type old_bytes = round_up(old_count * sizeof(T));
+    size_type new_bytes = round_up(new_count * sizeof(T));
+    auto* base = reinterpret_cast<char*>(ptr);
+    if (new_bytes > old_bytes) {
+      commit(base, old_bytes, new_bytes);
+    } else if (new_bytes < old_bytes) {
+      madvise(base + new_bytes, old_bytes - new_bytes, MADV_DONTNEED);
+      mprotect(base + new_bytes, old_bytes - new_bytes, PROT_NONE);
+    }
+    return true;
+  }
+
+  [[nodiscard]] size_type max_size() const noexcept { return reserve_bytes_ / sizeof(T); }
+  [[nodiscard]] size_type reserve_bytes() const noexcept { return reserve_bytes_; }
+
+  template <typename U>
+  bool operator==(const address_space_allocator<U>& other) const noexcept {
+    return reserve_bytes_ == other.reserve_bytes();
+  }
+
+  static size_type page_size() noexcept {
+    static const auto k_page_size = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+    return k_page_size;
+  }
+
+ private:
+  size_type reserve_bytes_;
+
+  static size_type round_up(size_type bytes) noexcept {
+    return (bytes + page_size() - 1) / page_size() * page_size();
+  }
+
+  void check_reservation(size_type count) const {
+    if (count > max_size()) {
+      throw std::length_error("address_space_allocator: reservation exhausted");
+    }
+  }
+
+  static void commit(char* base, size_type from, size_type to) {
+    if (to > from && mprotect(base + from, to - from, PROT_READ | PROT_WRITE) != 0) {
+      throw std::bad_alloc();
+    }
+  }
+};
+} // namespace s21
+
+#endif // S21_ADDRESS_SPACE_ALLOCATOR_H_
@@ -0,0 +1,115 @@
+#ifndef S21_HUGEPAGE_ALLOCATOR_H_
+#define S21_HUGEPAGE_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace s21 {
+// Allocator for large contiguous buffers. Requests of at least Threshold
+// bytes are served by 2 MB-aligned anonymous mappings advised with
+// MADV_HUGEPAGE so the kernel can back them with transparent huge pages;
+// smaller ones go to the regular heap.
+template <typename T, std::size_t Threshold = (std::size_t(2) << 20)>
+class hugepage_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = hugepage_allocator<U, Threshold>;
+  };
+
+  static constexpr size_type k_huge_page_size = size_type(2) << 20;
+
+  constexpr hugepage_allocator() noexcept = default;
+  template <typename U>
+  constexpr hugepage_allocator(const hugepage_allocator<U, Threshold>&) noexcept {}
+
+  [[nodiscard]] T* allocate(size_type count) {
+    if (count > std::size_t(-1) / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    size_type bytes = count * sizeof(T);
+    if (!is_huge(bytes)) {
+      return std::allocator<T>().allocate(count);
+    }
+    return static_cast<T*>(map_huge(round_up(bytes)));
+  }
+
+  void deallocate(T* ptr, size_type count) noexcept {
+    size_type bytes = count * sizeof(T);
+    if (!is_huge(bytes)) {
+      std::allocator<T>().deallocate(ptr, count);
+    } else {
+      unmap_huge(ptr, round_up(bytes));
+    }
+  }
+
+  template <typename U>
+  bool operator==(const hugepage_allocator<U, Threshold>&) const noexcept {
+    return true;
+  }
+
+  static constexpr bool is_huge(size_type bytes) noexcept {
+#ifdef __linux__
+    return bytes >= Threshold;
+#else
+    (void)bytes;
+    return false;
+#endif
+  }
+
+ private:
+  static constexpr size_type round_up(size_type bytes) noexcept {
+    return (bytes + k_huge_page_size - 1) & ~(k_huge_page_size - 1);
+  }
+
+#ifdef __linux__
+  // Maps bytes (a multiple of the huge page size) at a huge-page-aligned
+  // address by over-mapping one extra page and trimming both ends.
+  static void* map_huge(size_type bytes) {
+    size_type mapped = bytes + k_huge_page_size;
+    void* raw = mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+
+    auto begin = reinterpret_cast<std::uintptr_t>(raw);
+    auto aligned = (begin + k_huge_page_size - 1) & ~(k_huge_page_size - 1);
+    if (aligned != begin) {
+      munmap(raw, aligned - begin);
+    }
+    size_type tail = begin + mapped - (aligned + bytes);
+    if (tail != 0) {
+      munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+    }
+
+#ifdef MADV_HUGEPAGE
+    madvise(reinterpret_cast<void*>(aligned), bytes, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  static void unmap_huge(void* ptr, size_type bytes) noexcept {
+    munmap(ptr, bytes);
+  }
+#else
+  static void* map_huge(size_type) { throw std::bad_alloc(); }
+  static void unmap_huge(void*, size_type) noexcept {}
+#endif
+};
+} // namespace s21
+
+#endif // S21_HUGEPAGE_ALLOCATOR_H_
@@ -0,0 +1,229 @@
+#ifndef S21_NODE_POOL_ALLOCATOR_H_
+#define S21_NODE_POOL_ALLOCATOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+namespace allocator_details {
+// Hands out fixed-size blocks carved from slabs, one size class per block
+// size and alignment. Freed blocks go to the class's free list and are
+// reused first; slabs are only returned to the heap when the pool dies.
+// Not thread-safe.
+class node_pool {
+  struct free_block {
+    free_block* next;
+  };
+
+  struct slab {
+    slab* next;
+    std::size_t bytes;
+    std::size_t align;
+  };
+
+ public:
+  // Slabs start at k_min_slab_blocks blocks and double up to
+  // k_max_slab_bytes, so small containers do not pay for big slabs.
+  static constexpr std::size_t k_min_slab_blocks = 16;
+  static constexpr std::size_t k_max_slab_bytes = std::size_t(64) << 10;
+
+  class size_class {
+   public:
+    size_class(node_pool* pool, std::size_t size, std::size_t align) noexcept
+      : pool_(pool),
+        align_(std::max(align, alignof(free_block))),
+        block_size_(round_up(std::max(size, sizeof(free_block)), align_)) {}
+
+    void* allocate() {
+      if (free_) {
+        free_block* block = free_;
+        free_ = block->next;
+        return block;
+      }
+      if (cursor_ == end_) {
+        refill();
+      }
+      void* block = cursor_;
+      cursor_ += block_size_;
+      return block;
+    }
+
+    // count consecutive blocks, each of which may be deallocated on its own.
+    void* allocate_run(std::size_t count) {
+      if (count > std::size_t(-1) / 2 / block_size_) {
+        throw std::bad_array_new_length();
+      }
+      if (static_cast<std::size_t>(end_ - cursor_) < count * block_size_) {
+        // What is left of the current slab serves later single allocations
+        for (; cursor_ != end_; cursor_ += block_size_) {
+          deallocate(cursor_);
+        }
+        refill(count);
+      }
+      void* run = cursor_;
+      cursor_ += count * block_size_;
+      return run;
+    }
+
+    void deallocate(void* ptr) noexcept {
+      auto* block = static_cast<free_block*>(ptr);
+      block->next = free_;
+      free_ = block;
+    }
+
+    bool serves(std::size_t size, std::size_t align) const noexcept {
+      std::size_t block_align = std::max(align, alignof(free_block));
+      return block_align == align_
+          && round_up(std::max(size, sizeof(free_block)), block_align) == block_size_;
+    }
+
+   private:
+    friend class node_pool;
+
+    void refill(std::size_t min_blocks = 1) {
+      std::size_t limit = std::max(k_min_slab_blocks, k_max_slab_bytes / block_size_);
+      std::size_t blocks = std::max(std::min(next_slab_blocks_, limit), min_blocks);
+      // The slab header takes the first block-aligned chunk
+      std::size_t header = round_up(sizeof(slab), align_);
+      cursor_ = pool_->new_slab(header + blocks * block_size_, align_) + header;
+      end_ = cursor_ + blocks * block_size_;
+      next_slab_blocks_ = std::min(next_slab_blocks_ * 2, limit);
+    }
+
+    node_pool* pool_;
+    size_class* next_ = nullptr;
+    std::size_t align_;
+    std::size_t block_size_;
+    free_block* free_ = nullptr;
+    char* cursor_ = nullptr;
+    char* end_ = nullptr;
+    std::size_t next_slab_blocks_ = k_min_slab_blocks;
+  };
+
+  node_pool() noexcept = default;
+  node_pool(const node_pool&) = delete;
+  node_pool& operator=(const node_pool&) = delete;
+  ~node_pool() {
+    while (slabs_) {
+      slab* next = slabs_->next;
+      ::operator delete(slabs_, slabs_->bytes, std::align_val_t(slabs_->align));
+      slabs_ = next;
+    }
+    while (classes_) {
+      size_class* next = classes_->next_;
+      delete classes_;
+      classes_ = next;
+    }
+  }
+
+  // The class serving blocks of size bytes aligned to align, created on
+  // first use. Types of equal rounded size share a class.
+  size_class* find(std::size_t size, std::size_t align) {
+    for (size_class* current = classes_; current; current = current->next_) {
+      if (current->serves(size, align)) {
+        return current;
+      }
+    }
+    auto* created = new size_class(this, size, align);
+    created->next_ = classes_;
+    classes_ = created;
+    return created;
+  }
+
+ private:
+  static constexpr std::size_t round_up(std::size_t size, std::size_t align) noexcept {
+    return (size + align - 1) / align * align;
+  }
+
+  char* new_slab(std::size_t bytes, std::size_t align) {
+    align = std::max(align, alignof(slab));
+    auto* raw = static_cast<slab*>(::operator new(bytes, std::align_val_t(align)));
+    raw->next = slabs_;
+    raw->bytes = bytes;
+    raw->align = align;
+    slabs_ = raw;
+    return reinterpret_cast<char*>(raw);
+  }
+
+  size_class* classes_ = nullptr;
+  slab* slabs_ = nullptr;
+};
+} // namespace allocator_details
+
+// Single-object allocator for node-based containers. Nodes are carved out
+// of large slabs and recycled through a free list, so building a list
+// costs one heap allocation per slab instead of one per element and
+// neighbouring nodes are neighbours in memory. Copies and rebound copies
+// share the pool; it is released when the last of them goes away.
+// Requests for more than one object go to the regular heap.
+//
+// The pool is not synchronized: containers sharing it must be used from
+// one thread at a time.
+template <typename T>
+class node_pool_allocator {
+  template <typename U>
+  friend class node_pool_allocator;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  node_pool_allocator() : pool_(std::make_shared<allocator_details::node_pool>()) {}
+  // Copies never throw, so they do not declare a move: a moved-from
+  // container keeps a usable pool for its remaining nodes.
+  node_pool_allocator(const node_pool_allocator&) noexcept = default;
+  node_pool_allocator& operator=(const node_pool_allocator&) noexcept = default;
+  template <typename U>
+  node_pool_allocator(const node_pool_allocator<U>& other) noexcept : pool_(other.pool_) {}
+
+  [[nodiscard]] T* allocate(size_type count) {
+    if (count != 1) {
+      return std::allocator<T>().allocate(count);
+    }
+    return static_cast<T*>(blocks()->allocate());
+  }
+
+  // count consecutive objects that are deallocated one at a time, for
+  // containers that build many nodes at once.
+  [[nodiscard]] T* allocate_contiguous(size_type count) {
+    return static_cast<T*>(blocks()->allocate_run(count));
+  }
+
+  // The size class of a block being freed already exists, so looking it up
+  // does not allocate.
+  void deallocate(T* ptr, size_type count) noexcept {
+    if (count != 1) {
+      std::allocator<T>().deallocate(ptr, count);
+    } else {
+      blocks()->deallocate(ptr);
+    }
+  }
+
+  template <typename U>
+  bool operator==(const node_pool_allocator<U>& other) const noexcept {
+    return pool_ == other.pool_;
+  }
+
+ private:
+  allocator_details::node_pool::size_class* blocks() {
+    if (!class_) {
+      class_ = pool_->find(sizeof(T), alignof(T));
+    }
+    return class_;
+  }
+
+  std::shared_ptr<allocator_details::node_pool> pool_;
+  // Resolved on first use
+  allocator_details::node_pool::size_class* class_ = nullptr;
+};
+} // namespace s21
+
+#endif // S21_NODE_POOL_ALLOCATOR_H_
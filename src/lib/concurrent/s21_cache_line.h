@@ -0,0 +1,13 @@
+#ifndef S21_CACHE_LINE_H_
+#define S21_CACHE_LINE_H_
+
+#include <cstddef>
+
+namespace s21 {
+// Alignment that keeps data written by different threads on different
+// cache lines. std::hardware_destructive_interference_size is not used
+// because its value may differ between translation units.
+inline constexpr std::size_t k_cache_line_size = 64;
+} // namespace s21
+
+#endif // S21_CACHE_LINE_H_
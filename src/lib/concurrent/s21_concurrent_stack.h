@@ -0,0 +1,222 @@
+#ifndef S21_CONCURRENT_STACK_H_
+#define S21_CONCURRENT_STACK_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_cache_line.h"
+
+namespace s21 {
+namespace concurrent_details {
+// A Treiber stack of intrusive nodes whose head packs the node address and
+// a modification tag into one lock-free 64-bit word. Every successful pop
+// bumps the tag, so a CAS prepared against a head that has since been popped
+// and pushed again (ABA) fails. Addresses must fit in the low 48 bits on
+// 64-bit targets, which holds for user space on x86-64 and AArch64.
+template <typename Node>
+class tagged_stack {
+ public:
+  static constexpr int k_pointer_bits = sizeof(void*) == 8 ? 48 : 32;
+  static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+    "tagged_stack needs lock-free 64-bit atomics");
+
+  static bool fits(const Node* node) noexcept {
+    return (static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(node)) >> k_pointer_bits) == 0;
+  }
+
+  // Links the chain first -> ... -> last (through Node::next) on top.
+  void push_chain(Node* first, Node* last) noexcept {
+    std::uint64_t head = head_.load(std::memory_order_relaxed);
+    do {
+      last->next.store(pointer(head), std::memory_order_relaxed);
+    } while (!head_.compare_exchange_weak(head, pack(first, tag(head)),
+                                          std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  // Unlinks the top node, or returns nullptr when empty. A popped node may
+  // still be read by threads that lost the race for it, so its memory must
+  // outlive the stack; it may be reused.
+  Node* pop() noexcept {
+    std::uint64_t head = head_.load(std::memory_order_acquire);
+    while (Node* node = pointer(head)) {
+      Node* next = node->next.load(std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(head, pack(next, tag(head) + 1),
+                                      std::memory_order_acquire, std::memory_order_acquire)) {
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
+  bool empty() const noexcept { return pointer(head_.load(std::memory_order_relaxed)) == nullptr; }
+
+  // The whole chain, for single-threaded teardown.
+  Node* top() const noexcept { return pointer(head_.load(std::memory_order_acquire)); }
+
+ private:
+  static constexpr std::uint64_t k_pointer_mask =
+    k_pointer_bits == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << k_pointer_bits) - 1;
+
+  static Node* pointer(std::uint64_t head) noexcept {
+    return reinterpret_cast<Node*>(static_cast<std::uintptr_t>(head & k_pointer_mask));
+  }
+  static std::uint64_t tag(std::uint64_t head) noexcept { return head >> k_pointer_bits; }
+  static std::uint64_t pack(Node* node, std::uint64_t tag) noexcept {
+    return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(node)) | (tag << k_pointer_bits);
+  }
+
+  alignas(k_cache_line_size) std::atomic<std::uint64_t> head_{0};
+};
+} // namespace concurrent_details
+
+// A lock-free LIFO for any number of threads, next to the single-threaded
+// s21::stack. Nodes are never returned to the allocator while the stack
+// lives: popped nodes go to an internal free list (itself a tagged Treiber
+// stack) and are reused by later pushes, which makes it safe for a losing
+// thread to read a node that was just popped. Memory is released by the
+// destructor.
+template <typename T, typename Allocator = std::allocator<T>>
+class concurrent_stack {
+  struct node {
+    std::atomic<node*> next{nullptr};
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+  };
+
+  using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using reference = T&;
+  using const_reference = const T&;
+
+  concurrent_stack() noexcept(noexcept(allocator_type())) : concurrent_stack(allocator_type()) {}
+  explicit concurrent_stack(const allocator_type& alloc) noexcept : allocator_(alloc) {}
+  concurrent_stack(const concurrent_stack&) = delete;
+  concurrent_stack& operator=(const concurrent_stack&) = delete;
+  ~concurrent_stack() {
+    for (node* item = items_.top(); item;) {
+      node* next = item->next.load(std::memory_order_relaxed);
+      std::destroy_at(item->value());
+      release_node(item);
+      item = next;
+    }
+    for (node* item = free_.top(); item;) {
+      node* next = item->next.load(std::memory_order_relaxed);
+      release_node(item);
+      item = next;
+    }
+  }
+
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    node* item = make_node(std::forward<Args>(args)...);
+    items_.push_chain(item, item);
+  }
+  void push(const_reference value) { emplace(value); }
+  void push(value_type&& value) { emplace(std::move(value)); }
+
+  // Pushes [first, last) with a single CAS; the last element ends up on top.
+  template <std::input_iterator It>
+  void push_many(It first, It last) {
+    node* top = nullptr;
+    node* bottom = nullptr;
+    try {
+      for (; first != last; ++first) {
+        node* item = make_node(*first);
+        item->next.store(top, std::memory_order_relaxed);
+        top = item;
+        bottom = bottom ? bottom : item;
+      }
+    } catch (...) {
+      if (top) {
+        destroy_values(top);
+        free_.push_chain(top, bottom);
+      }
+      throw;
+    }
+    if (top) {
+      items_.push_chain(top, bottom);
+    }
+  }
+  void push_many(std::initializer_list<value_type> items) {
+    push_many(items.begin(), items.end());
+  }
+
+  // Moves the top element into out; false when the stack is empty.
+  bool try_pop(reference out) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    node* item = items_.pop();
+    if (!item) {
+      return false;
+    }
+    if constexpr (std::is_nothrow_move_assignable_v<T>) {
+      out = std::move(*item->value());
+    } else {
+      try {
+        out = std::move(*item->value());
+      } catch (...) {
+        items_.push_chain(item, item);
+        throw;
+      }
+    }
+    std::destroy_at(item->value());
+    free_.push_chain(item, item);
+    return true;
+  }
+
+  // Approximate while other threads are pushing or popping.
+  [[nodiscard]] bool empty() const noexcept { return items_.empty(); }
+
+ private:
+  using node_stack = concurrent_details::tagged_stack<node>;
+
+  template <typename... Args>
+  node* make_node(Args&&... args) {
+    node* item = free_.pop();
+    if (!item) {
+      item = std::to_address(node_traits::allocate(allocator_, 1));
+      if (!node_stack::fits(item)) {
+        node_traits::deallocate(allocator_, item, 1);
+        throw std::bad_alloc();
+      }
+      std::construct_at(item);
+    }
+    try {
+      std::construct_at(item->value(), std::forward<Args>(args)...);
+    } catch (...) {
+      free_.push_chain(item, item);
+      throw;
+    }
+    return item;
+  }
+
+  // Destroys the values of a private chain.
+  static void destroy_values(node* item) noexcept {
+    for (; item; item = item->next.load(std::memory_order_relaxed)) {
+      std::destroy_at(item->value());
+    }
+  }
+
+  void release_node(node* item) noexcept {
+    std::destroy_at(item);
+    node_traits::deallocate(allocator_, item, 1);
+  }
+
+  [[no_unique_address]] node_allocator allocator_;
+  node_stack items_;
+  node_stack free_;
+};
+} // namespace s21
+
+#endif // S21_CONCURRENT_STACK_H_
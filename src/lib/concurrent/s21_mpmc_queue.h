@@ -0,0 +1,266 @@
+#ifndef S21_MPMC_QUEUE_H_
+#define S21_MPMC_QUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_cache_line.h"
+
+namespace s21 {
+// A bounded lock-free queue for any number of producer and consumer
+// threads, after Dmitry Vyukov's bounded MPMC queue. Every slot carries a
+// sequence number telling whether it is ready for the producer or the
+// consumer of the current lap, so a push or pop costs one CAS on the
+// shared position plus an uncontended store to its own slot.
+//
+// try_ functions never block and return how much they did; push, pop,
+// push_n and pop_n yield until they are done. Batch functions claim a run
+// of consecutive slots with a single CAS.
+//
+// T must be nothrow move constructible and assignable: a claimed slot has
+// to be filled or released. Values that may throw while being built are
+// built before a slot is claimed. If an output iterator throws in
+// try_pop_n or pop_n, the values that call claimed but did not write out
+// are dropped and the exception propagates; the queue stays usable.
+template <typename T, typename Allocator = std::allocator<T>>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+    "mpmc_queue elements must be nothrow movable");
+
+  struct cell {
+    std::atomic<std::size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+  };
+
+  using cell_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<cell>;
+  using cell_traits = std::allocator_traits<cell_allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using reference = T&;
+  using const_reference = const T&;
+
+  // The capacity is rounded up to a power of two.
+  explicit mpmc_queue(size_type capacity, const allocator_type& alloc = allocator_type())
+    : allocator_(alloc), capacity_(std::bit_ceil(std::max<size_type>(capacity, 1))) {
+    cells_ = cell_traits::allocate(allocator_, capacity_);
+    for (size_type i = 0; i < capacity_; ++i) {
+      std::construct_at(std::addressof(cells_[i].sequence), i);
+    }
+  }
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+  ~mpmc_queue() {
+    for (size_type pos = dequeue_pos_; pos != enqueue_pos_; ++pos) {
+      std::destroy_at(cell_at(pos).value());
+    }
+    for (size_type i = 0; i < capacity_; ++i) {
+      std::destroy_at(std::addressof(cells_[i].sequence));
+    }
+    cell_traits::deallocate(allocator_, cells_, capacity_);
+  }
+
+  template <typename... Args>
+  bool try_emplace(Args&&... args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+      size_type pos = 0;
+      if (claim_push(1, pos) == 0) {
+        return false;
+      }
+      std::construct_at(cell_at(pos).value(), std::forward<Args>(args)...);
+      cell_at(pos).sequence.store(pos + 1, std::memory_order_release);
+      return true;
+    } else {
+      T value(std::forward<Args>(args)...);
+      return try_emplace(std::move(value));
+    }
+  }
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+  bool try_pop(reference out) noexcept {
+    size_type pos = 0;
+    if (claim_pop(1, pos) == 0) {
+      return false;
+    }
+    release_pop(pos, out);
+    return true;
+  }
+
+  // Pushes up to count values read from first; returns how many.
+  template <std::input_iterator It>
+    requires std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>
+  size_type try_push_n(It first, size_type count) {
+    return push_some(first, count);
+  }
+
+  // Pops up to count values into d_first; returns how many.
+  template <std::output_iterator<T&&> OutIt>
+  size_type try_pop_n(OutIt d_first, size_type count) {
+    return pop_some(d_first, count);
+  }
+
+  // Blocking wrappers.
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+      while (!try_emplace(std::forward<Args>(args)...)) {
+        std::this_thread::yield();
+      }
+    } else {
+      T value(std::forward<Args>(args)...);
+      emplace(std::move(value));
+    }
+  }
+  void push(const_reference value) { emplace(value); }
+  void push(value_type&& value) { emplace(std::move(value)); }
+
+  void pop(reference out) noexcept {
+    while (!try_pop(out)) {
+      std::this_thread::yield();
+    }
+  }
+
+  template <std::input_iterator It>
+    requires std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>
+  It push_n(It first, size_type count) {
+    while ((count -= push_some(first, count)) != 0) {
+      std::this_thread::yield();
+    }
+    return first;
+  }
+
+  template <std::output_iterator<T&&> OutIt>
+  OutIt pop_n(OutIt d_first, size_type count) {
+    while ((count -= pop_some(d_first, count)) != 0) {
+      std::this_thread::yield();
+    }
+    return d_first;
+  }
+
+  // Approximate while other threads are pushing or popping.
+  [[nodiscard]] size_type size() const noexcept {
+    size_type dequeued = dequeue_pos_.load(std::memory_order_acquire);
+    size_type enqueued = enqueue_pos_.load(std::memory_order_acquire);
+    return enqueued > dequeued ? std::min(enqueued - dequeued, capacity_) : 0;
+  }
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+  [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  cell& cell_at(size_type pos) const noexcept { return cells_[pos & (capacity_ - 1)]; }
+
+  // Claims up to count consecutive slots whose sequence equals pos + i +
+  // Lag (0 for a push, 1 for a pop) by moving position past them. Returns
+  // the number claimed and their first position in first.
+  template <size_type Lag>
+  size_type claim(std::atomic<size_type>& position, size_type count, size_type& first) noexcept {
+    size_type pos = position.load(std::memory_order_relaxed);
+    while (count != 0) {
+      size_type ready = 0;
+      auto diff = std::ptrdiff_t();
+      for (; ready < count; ++ready) {
+        size_type seq = cell_at(pos + ready).sequence.load(std::memory_order_acquire);
+        diff = static_cast<std::ptrdiff_t>(seq - (pos + ready + Lag));
+        if (diff != 0) {
+          break;
+        }
+      }
+      if (ready != 0) {
+        if (position.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+          first = pos;
+          return ready;
+        }
+      } else if (diff < 0) {
+        // The slot still holds the previous lap: full for a push, empty for a pop
+        return 0;
+      } else {
+        pos = position.load(std::memory_order_relaxed);
+      }
+    }
+    return 0;
+  }
+
+  size_type claim_push(size_type count, size_type& first) noexcept {
+    return claim<0>(enqueue_pos_, count, first);
+  }
+  size_type claim_pop(size_type count, size_type& first) noexcept {
+    return claim<1>(dequeue_pos_, count, first);
+  }
+
+  // Moves the value at the claimed position pos into out and hands the
+  // slot to the producer of the next lap. The slot is handed on even if
+  // writing to out throws; its value is then lost.
+  template <typename Out>
+  void release_pop(size_type pos, Out&& out)
+    noexcept(noexcept(std::forward<Out>(out) = std::declval<T>())) {
+    struct slot_guard {
+      ~slot_guard() { queue->free_slot(pos); }
+      mpmc_queue* queue;
+      size_type pos;
+    } guard{this, pos};
+    std::forward<Out>(out) = std::move(*cell_at(pos).value());
+  }
+
+  void free_slot(size_type pos) noexcept {
+    cell& slot = cell_at(pos);
+    std::destroy_at(slot.value());
+    slot.sequence.store(pos + capacity_, std::memory_order_release);
+  }
+
+  // Batch steps, advancing the iterator past the values transferred.
+  template <typename It>
+  size_type push_some(It& first, size_type count) {
+    size_type pos = 0;
+    size_type claimed = claim_push(count, pos);
+    for (size_type i = 0; i < claimed; ++i, ++first) {
+      std::construct_at(cell_at(pos + i).value(), *first);
+      cell_at(pos + i).sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    return claimed;
+  }
+
+  // If the output iterator throws, the rest of the claimed values are
+  // destroyed so their slots still go back to the producers.
+  template <typename OutIt>
+  size_type pop_some(OutIt& d_first, size_type count) {
+    size_type pos = 0;
+    size_type claimed = claim_pop(count, pos);
+    size_type done = 0;
+    try {
+      for (; done < claimed; ++d_first) {
+        auto&& target = *d_first;
+        release_pop(pos + done++, std::forward<decltype(target)>(target));
+      }
+    } catch (...) {
+      for (; done < claimed; ++done) {
+        free_slot(pos + done);
+      }
+      throw;
+    }
+    return claimed;
+  }
+
+  // Read-only after construction
+  [[no_unique_address]] cell_allocator allocator_;
+  typename cell_traits::pointer cells_;
+  size_type capacity_;
+
+  alignas(k_cache_line_size) std::atomic<size_type> enqueue_pos_{0};
+  alignas(k_cache_line_size) std::atomic<size_type> dequeue_pos_{0};
+};
+} // namespace s21
+
+#endif // S21_MPMC_QUEUE_H_
@@ -0,0 +1,132 @@
+#ifndef S21_SPSC_QUEUE_H_
+#define S21_SPSC_QUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "s21_cache_line.h"
+
+namespace s21 {
+// A bounded lock-free queue for exactly one producer thread and one
+// consumer thread. push/try_push may only be called by the producer,
+// front/pop/try_pop only by the consumer; size and empty are safe anywhere
+// but only approximate while the other side is running.
+//
+// The indices written by each side live on their own cache line next to
+// that side's cached copy of the other index, so the shared lines are only
+// read when the cached value says the ring is full (or empty).
+template <typename T, typename Allocator = std::allocator<T>>
+class spsc_queue {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using reference = T&;
+  using const_reference = const T&;
+
+  // The capacity is rounded up to a power of two.
+  explicit spsc_queue(size_type capacity, const allocator_type& alloc = allocator_type())
+    : allocator_(alloc), capacity_(std::bit_ceil(std::max<size_type>(capacity, 1))) {
+    data_ = alloc_traits::allocate(allocator_, capacity_);
+  }
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+  ~spsc_queue() {
+    while (front()) {
+      pop();
+    }
+    alloc_traits::deallocate(allocator_, data_, capacity_);
+  }
+
+  // Producer side. try_ functions return false when the queue is full,
+  // push waits for the consumer to make room.
+  template <typename... Args>
+  bool try_emplace(Args&&... args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ == capacity_) {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ == capacity_) {
+        return false;
+      }
+    }
+    alloc_traits::construct(allocator_, std::addressof(slot(tail)), std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+  // A failed try_emplace leaves args untouched, so they can be forwarded
+  // again on every attempt.
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    while (!try_emplace(std::forward<Args>(args)...)) {
+      std::this_thread::yield();
+    }
+  }
+  void push(const_reference value) { emplace(value); }
+  void push(value_type&& value) { emplace(std::move(value)); }
+
+  // Consumer side. front returns nullptr when the queue is empty; pop must
+  // only follow a non-null front.
+  T* front() noexcept {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (head == tail_cache_) {
+      tail_cache_ = tail_.load(std::memory_order_acquire);
+      if (head == tail_cache_) {
+        return nullptr;
+      }
+    }
+    return std::addressof(slot(head));
+  }
+
+  void pop() noexcept {
+    size_type head = head_.load(std::memory_order_relaxed);
+    alloc_traits::destroy(allocator_, std::addressof(slot(head)));
+    head_.store(head + 1, std::memory_order_release);
+  }
+
+  bool try_pop(reference out) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    T* value = front();
+    if (!value) {
+      return false;
+    }
+    out = std::move(*value);
+    pop();
+    return true;
+  }
+
+  [[nodiscard]] size_type size() const noexcept {
+    size_type head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+  }
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+  [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+ private:
+  reference slot(size_type pos) const noexcept { return data_[pos & (capacity_ - 1)]; }
+
+  // Read-only after construction, shared by both sides
+  [[no_unique_address]] allocator_type allocator_;
+  typename alloc_traits::pointer data_;
+  size_type capacity_;
+
+  // Written by the producer: free-running count of pushes
+  alignas(k_cache_line_size) std::atomic<size_type> tail_{0};
+  size_type head_cache_ = 0;
+
+  // Written by the consumer: free-running count of pops
+  alignas(k_cache_line_size) std::atomic<size_type> head_{0};
+  size_type tail_cache_ = 0;
+};
+} // namespace s21
+
+#endif // S21_SPSC_QUEUE_H_
@@ -0,0 +1,319 @@
+#ifndef S21_THREAD_POOL_H_
+#define S21_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "../deque/s21_deque.h"
+#include "../vector/s21_vector.h"
+#include "s21_ws_deque.h"
+
+namespace s21 {
+// A work-stealing scheduler. Every worker owns a s21::ws_deque: tasks
+// submitted from a worker go to the bottom of its own deque and are run
+// LIFO, idle workers steal the oldest tasks of a random victim, and tasks
+// submitted from other threads go through a shared injection queue.
+// Threads that wait for tasks (wait_all, parallel_for) run queued tasks
+// meanwhile, so nested parallel_for calls from inside tasks do not
+// deadlock. Idle workers sleep until a task is queued; a waiter with
+// nothing to run sleeps until a task is queued or its tasks finish.
+class thread_pool {
+ public:
+  explicit thread_pool(std::size_t threads) {
+    deques_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+      deques_.push_back(std::make_unique<ws_deque<task*>>());
+    }
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers_.emplace_back([this, i] { worker_loop(i); });
+    }
+  }
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+  // Runs the tasks still queued, then stops the workers.
+  ~thread_pool() {
+    wait_for(submitted_);
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  // The pool shared by s21::par and library users, one thread per core
+  // besides the thread that waits on it.
+  static thread_pool& instance() {
+    static thread_pool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+  }
+
+  // Threads running tasks while one thread waits, the waiter included.
+  std::size_t concurrency() const noexcept { return workers_.size() + 1; }
+
+  // Queues fn() to run on some thread of the pool.
+  template <typename Fn>
+  void submit(Fn&& fn) {
+    enqueue(new fn_task<std::decay_t<Fn>>(std::forward<Fn>(fn), &submitted_));
+  }
+
+  // Runs queued tasks until every task passed to submit has finished, then
+  // rethrows the first exception any of them threw.
+  void wait_all() {
+    wait_for(submitted_);
+    submitted_.rethrow();
+  }
+
+  // Calls fn(i) for every i in [0, count) on up to concurrency() threads,
+  // the caller included, and returns when all calls are done. The first
+  // exception thrown is rethrown here; indices not started by then are
+  // skipped.
+  template <typename Fn>
+  void parallel_for(std::size_t count, const Fn& fn) {
+    if (count <= 1 || workers_.empty()) {
+      for (std::size_t i = 0; i < count; ++i) {
+        fn(i);
+      }
+      return;
+    }
+
+    task_group group;
+    std::atomic<std::size_t> next{0};
+    auto body = [&] {
+      for (std::size_t i = next.fetch_add(1); i < count && !group.failed(); i = next.fetch_add(1)) {
+        fn(i);
+      }
+    };
+    std::size_t helpers = std::min(count, concurrency()) - 1;
+    try {
+      for (std::size_t i = 0; i < helpers; ++i) {
+        enqueue(new fn_task<decltype(body)>(body, &group));
+      }
+      body();
+    } catch (...) {
+      group.fail(std::current_exception());
+    }
+    wait_for(group);
+    group.rethrow();
+  }
+
+ private:
+  // Tasks waited for together. pending is the last member a finishing task
+  // touches, so the group may be destroyed as soon as it reads zero.
+  struct task_group {
+    std::atomic<std::size_t> pending{0};
+    std::atomic<bool> has_error{false};
+    std::exception_ptr error;
+
+    bool failed() const noexcept { return has_error.load(std::memory_order_relaxed); }
+    void fail(std::exception_ptr exception) noexcept {
+      if (!has_error.exchange(true)) {
+        error = std::move(exception);
+      }
+    }
+    void rethrow() {
+      if (has_error.load(std::memory_order_acquire)) {
+        std::exception_ptr exception = std::exchange(error, nullptr);
+        has_error.store(false, std::memory_order_relaxed);
+        std::rethrow_exception(exception);
+      }
+    }
+  };
+
+  struct task {
+    explicit task(task_group* owner) noexcept : group(owner) {}
+    virtual ~task() = default;
+    virtual void run() = 0;
+
+    task_group* group;
+  };
+
+  template <typename Fn>
+  struct fn_task final : task {
+    template <typename F>
+    fn_task(F&& f, task_group* owner) : task(owner), fn(std::forward<F>(f)) {}
+    void run() override { fn(); }
+
+    Fn fn;
+  };
+
+  // The pool and deque index of the calling thread, if it is a worker.
+  struct worker_id {
+    thread_pool* pool = nullptr;
+    std::size_t index = 0;
+  };
+  static worker_id& current_worker() noexcept {
+    thread_local worker_id id;
+    return id;
+  }
+
+  void enqueue(task* item) {
+    task_group* group = item->group;
+    group->pending.fetch_add(1, std::memory_order_relaxed);
+    queued_.fetch_add(1, std::memory_order_seq_cst);
+    try {
+      worker_id& self = current_worker();
+      if (self.pool == this) {
+        deques_[self.index]->push(item);
+      } else {
+        std::lock_guard<std::mutex> lock(inject_mutex_);
+        injected_.push_back(item);
+        injected_count_.store(injected_.size(), std::memory_order_relaxed);
+      }
+    } catch (...) {
+      queued_.fetch_sub(1, std::memory_order_relaxed);
+      group->pending.fetch_sub(1, std::memory_order_relaxed);
+      delete item;
+      throw;
+    }
+    // Pairs with the sleepers_ increment in worker_loop: either the sleeper
+    // sees the new task or this thread sees the sleeper.
+    if (sleepers_.load(std::memory_order_seq_cst) != 0) {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      wake_.notify_one();
+    }
+    notify_waiters();
+  }
+
+  // Wakes the threads blocked in wait_for. Pairs with the waiters_
+  // increment there, like sleepers_ above.
+  void notify_waiters() {
+    if (waiters_.load(std::memory_order_seq_cst) != 0) {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      done_.notify_all();
+    }
+  }
+
+  // Own deque first, then the injection queue, then one pass over the
+  // other deques starting from a random victim.
+  task* take() {
+    worker_id& self = current_worker();
+    bool is_worker = self.pool == this;
+    if (is_worker) {
+      if (auto item = deques_[self.index]->pop()) {
+        return *item;
+      }
+    }
+    if (injected_count_.load(std::memory_order_relaxed) != 0) {
+      std::lock_guard<std::mutex> lock(inject_mutex_);
+      if (!injected_.empty()) {
+        task* item = injected_.front();
+        injected_.pop_front();
+        injected_count_.store(injected_.size(), std::memory_order_relaxed);
+        return item;
+      }
+    }
+    std::size_t count = deques_.size();
+    std::size_t start = count != 0 ? next_random() % count : 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      std::size_t victim = (start + i) % count;
+      if (is_worker && victim == self.index) {
+        continue;
+      }
+      if (auto item = deques_[victim]->steal()) {
+        return *item;
+      }
+    }
+    return nullptr;
+  }
+
+  // Runs one queued task; false when none could be found.
+  bool run_one() {
+    task* item = take();
+    if (!item) {
+      return false;
+    }
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    task_group* group = item->group;
+    try {
+      item->run();
+    } catch (...) {
+      group->fail(std::current_exception());
+    }
+    delete item;
+    // The group may be gone once pending reads zero; only the pool is
+    // touched after this.
+    if (group->pending.fetch_sub(1, std::memory_order_seq_cst) == 1) {
+      notify_waiters();
+    }
+    return true;
+  }
+
+  // Runs queued tasks until group has none pending. Its remaining tasks
+  // may all be running elsewhere; then it sleeps until one of them is
+  // done or more work is queued.
+  void wait_for(task_group& group) {
+    while (group.pending.load(std::memory_order_acquire) != 0) {
+      if (run_one()) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      waiters_.fetch_add(1, std::memory_order_seq_cst);
+      done_.wait(lock, [&] {
+        return group.pending.load(std::memory_order_seq_cst) == 0 ||
+               queued_.load(std::memory_order_seq_cst) != 0;
+      });
+      waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  void worker_loop(std::size_t index) {
+    current_worker() = worker_id{this, index};
+    while (true) {
+      if (run_one()) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      sleepers_.fetch_add(1, std::memory_order_seq_cst);
+      wake_.wait(lock, [this] { return stop_ || queued_.load(std::memory_order_seq_cst) != 0; });
+      sleepers_.fetch_sub(1, std::memory_order_relaxed);
+      if (stop_) {
+        return;
+      }
+    }
+  }
+
+  static std::uint64_t next_random() noexcept {
+    thread_local std::uint64_t state =
+      std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  }
+
+  s21::vector<std::unique_ptr<ws_deque<task*>>> deques_;
+  s21::vector<std::thread> workers_;
+  task_group submitted_;
+
+  std::mutex inject_mutex_;
+  s21::deque<task*> injected_;
+  // injected_.size(), readable without the lock
+  std::atomic<std::size_t> injected_count_{0};
+
+  // Tasks queued and not yet taken, for the sleep/wake handshake
+  std::atomic<std::size_t> queued_{0};
+  std::atomic<std::size_t> sleepers_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+  // Threads blocked in wait_for, woken through done_
+  std::atomic<std::size_t> waiters_{0};
+  std::condition_variable done_;
+};
+} // namespace s21
+
+#endif // S21_THREAD_POOL_H_
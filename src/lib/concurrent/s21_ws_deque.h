@@ -0,0 +1,139 @@
+#ifndef S21_WS_DEQUE_H_
+#define S21_WS_DEQUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include "../vector/s21_vector.h"
+#include "s21_cache_line.h"
+
+namespace s21 {
+// The Chase-Lev work-stealing deque, after the C11 formulation of Le, Pop,
+// Cohen and Zappa Nardelli with its fences folded into seq_cst accesses of
+// top and bottom. One owner thread pushes and pops at the bottom;
+// any thread may steal from the top. The circular buffer doubles when full.
+// Thieves may still be reading a replaced buffer, so old buffers are kept
+// until the deque is destroyed (their total size is below the current one).
+//
+// T is copied through atomics and must be trivially copyable; task
+// schedulers store pointers.
+template <typename T>
+class ws_deque {
+  static_assert(std::is_trivially_copyable_v<T>, "ws_deque elements must be trivially copyable");
+
+  struct buffer {
+    explicit buffer(std::int64_t capacity) : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+    std::int64_t capacity() const noexcept { return mask + 1; }
+    T get(std::int64_t index) const noexcept { return slots[index & mask].load(std::memory_order_relaxed); }
+    void put(std::int64_t index, T value) noexcept { slots[index & mask].store(value, std::memory_order_relaxed); }
+
+    std::int64_t mask;
+    std::unique_ptr<std::atomic<T>[]> slots;
+  };
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  // The initial capacity is rounded up to a power of two.
+  explicit ws_deque(size_type capacity = 64) {
+    auto size = static_cast<std::int64_t>(std::bit_ceil(std::max<size_type>(capacity, 2)));
+    buffers_.push_back(std::make_unique<buffer>(size));
+    buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+  }
+  ws_deque(const ws_deque&) = delete;
+  ws_deque& operator=(const ws_deque&) = delete;
+
+  // Owner only.
+  void push(T value) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    buffer* buf = buffer_.load(std::memory_order_relaxed);
+    if (bottom - top > buf->capacity() - 1) {
+      buf = grow(buf, top, bottom);
+    }
+    buf->put(bottom, value);
+    bottom_.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Owner only: takes the most recently pushed element.
+  std::optional<T> pop() noexcept {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    buffer* buf = buffer_.load(std::memory_order_relaxed);
+    // The store to bottom_ and the load of top_ must not be reordered, or the
+    // owner and a thief could both take the last element
+    bottom_.store(bottom, std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_seq_cst);
+
+    std::optional<T> result;
+    if (top <= bottom) {
+      result = buf->get(bottom);
+      if (top == bottom) {
+        // Last element: race the thieves for it
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+          result.reset();
+        }
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+      }
+    } else {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  // Any thread: takes the oldest element. Returns nothing when the deque is
+  // empty or another thread won the race for the element.
+  std::optional<T> steal() noexcept {
+    std::int64_t top = top_.load(std::memory_order_seq_cst);
+    std::int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+
+    if (top < bottom) {
+      T value = buffer_.load(std::memory_order_acquire)->get(top);
+      if (top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        return value;
+      }
+    }
+    return std::nullopt;
+  }
+
+  // Approximate while other threads are working on the deque.
+  [[nodiscard]] size_type size() const noexcept {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+  }
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+  [[nodiscard]] size_type capacity() const noexcept {
+    return static_cast<size_type>(buffer_.load(std::memory_order_relaxed)->capacity());
+  }
+
+ private:
+  buffer* grow(buffer* old, std::int64_t top, std::int64_t bottom) {
+    auto bigger = std::make_unique<buffer>(old->capacity() * 2);
+    for (std::int64_t i = top; i != bottom; ++i) {
+      bigger->put(i, old->get(i));
+    }
+    buffers_.push_back(std::move(bigger));
+    buffer* result = buffers_.back().get();
+    buffer_.store(result, std::memory_order_release);
+    return result;
+  }
+
+  alignas(k_cache_line_size) std::atomic<std::int64_t> top_{0};
+  alignas(k_cache_line_size) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<buffer*> buffer_{nullptr};
+  // Every buffer ever used, owned by the owner thread
+  s21::vector<std::unique_ptr<buffer>> buffers_;
+};
+} // namespace s21
+
+#endif // S21_WS_DEQUE_H_
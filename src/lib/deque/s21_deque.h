@@ -0,0 +1,436 @@
+#ifndef S21_DEQUE_H_
+#define S21_DEQUE_H_
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Elements per block when none is given: about 4 KB, rounded down to a
+// power of two so that index arithmetic compiles to shifts and masks.
+template <typename T>
+inline constexpr std::size_t deque_block_size =
+  sizeof(T) <= 256 ? std::bit_floor(4096 / sizeof(T)) : 16;
+
+// A double-ended queue storing its elements in fixed blocks of BlockSize
+// elements, reached through a map of block pointers. Pushing and popping at
+// either end is O(1) and never moves elements; the map is regrown or
+// recentered when an end runs out of block slots. Blocks are allocated
+// through Allocator when an end enters them and released when it leaves.
+template <typename T, typename Allocator = std::allocator<T>,
+          std::size_t BlockSize = deque_block_size<T>>
+class deque {
+  static_assert(BlockSize > 0, "deque blocks must hold at least one element");
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using block_pointer = typename alloc_traits::pointer;
+  using map_allocator = typename alloc_traits::template rebind_alloc<block_pointer>;
+  using map_traits = std::allocator_traits<map_allocator>;
+  using map_pointer = typename map_traits::pointer;
+
+ public:
+  template <bool Const>
+  struct deque_iterator {
+    using Self = deque_iterator;
+
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    deque_iterator() noexcept : map_(), pos_(0) {}
+    template <bool OtherConst>
+      requires (Const && !OtherConst)
+    deque_iterator(const deque_iterator<OtherConst>& other) noexcept
+      : map_(other.map_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept { return map_[pos_ / BlockSize][pos_ % BlockSize]; }
+    pointer operator->() const noexcept { return std::addressof(**this); }
+
+    bool operator==(const Self& rhs) const noexcept { return pos_ == rhs.pos_; }
+    bool operator!=(const Self& rhs) const noexcept { return pos_ != rhs.pos_; }
+
+    bool operator<(const Self& rhs) const noexcept { return pos_ < rhs.pos_; }
+    bool operator>(const Self& rhs) const noexcept { return pos_ > rhs.pos_; }
+    bool operator<=(const Self& rhs) const noexcept { return pos_ <= rhs.pos_; }
+    bool operator>=(const Self& rhs) const noexcept { return pos_ >= rhs.pos_; }
+
+    Self& operator++() noexcept { ++pos_; return *this; }
+    Self operator++(int) noexcept {
+      Self tmp(*this);
+      ++pos_;
+      return tmp;
+    }
+
+    Self& operator--() noexcept { --pos_; return *this; }
+    Self operator--(int) noexcept {
+      Self tmp(*this);
+      --pos_;
+      return tmp;
+    }
+
+    difference_type operator-(const Self& rhs) const noexcept {
+      return static_cast<difference_type>(pos_) - static_cast<difference_type>(rhs.pos_);
+    }
+    friend Self operator+(difference_type n, const Self& iter) { return iter + n; }
+
+    Self operator+(difference_type diff) const noexcept {
+      Self tmp = *this;
+      tmp += diff;
+      return tmp;
+    }
+    Self& operator+=(difference_type diff) noexcept {
+      pos_ += static_cast<std::size_t>(diff);
+      return *this;
+    }
+
+    Self operator-(difference_type diff) const noexcept {
+      Self tmp = *this;
+      tmp -= diff;
+      return tmp;
+    }
+    Self& operator-=(difference_type diff) noexcept {
+      pos_ -= static_cast<std::size_t>(diff);
+      return *this;
+    }
+
+    reference operator[](difference_type diff) const noexcept { return *(*this + diff); }
+
+   private:
+    deque_iterator(map_pointer map, std::size_t pos) noexcept : map_(map), pos_(pos) {}
+
+    // Positions are absolute slots of the map, so iterators are invalidated
+    // when the map is regrown.
+    map_pointer map_;
+    std::size_t pos_;
+    friend class deque;
+    friend struct deque_iterator<true>;
+  };
+
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = typename alloc_traits::pointer;
+  using const_pointer = typename alloc_traits::const_pointer;
+
+  // Iterators:
+  using iterator = deque_iterator<false>;
+  using const_iterator = deque_iterator<true>;
+
+  static constexpr size_type k_block_size = BlockSize;
+
+  deque() noexcept(noexcept(allocator_type())) : deque(allocator_type()) {}
+
+  explicit deque(const allocator_type& alloc) noexcept
+    : allocator_(alloc), map_allocator_(alloc), map_(), map_size_(0), start_(0), size_(0) {}
+
+  explicit deque(size_type count, const allocator_type& alloc = allocator_type()) : deque(alloc) {
+    resize(count);
+  }
+
+  deque(size_type count, const_reference value, const allocator_type& alloc = allocator_type())
+    : deque(alloc) {
+    assign(count, value);
+  }
+
+  deque(std::initializer_list<value_type> const& items, const allocator_type& alloc = allocator_type())
+    : deque(alloc) {
+    assign(items.begin(), items.end());
+  }
+
+  template <std::input_iterator InputIt>
+  deque(InputIt first, InputIt last, const allocator_type& alloc = allocator_type()) : deque(alloc) {
+    assign(first, last);
+  }
+
+  deque(const deque& other)
+    : deque(other, alloc_traits::select_on_container_copy_construction(other.allocator_)) {}
+
+  deque(const deque& other, const allocator_type& alloc) : deque(alloc) {
+    assign(other.begin(), other.end());
+  }
+
+  deque(deque&& other) noexcept : deque(other.allocator_) {
+    take_storage(other);
+  }
+
+  ~deque() {
+    release_storage();
+  }
+
+  deque& operator=(const deque& other) {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  deque& operator=(deque&& other)
+    noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+             alloc_traits::is_always_equal::value) {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value ||
+                  alloc_traits::is_always_equal::value) {
+      release_storage();
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+        allocator_ = std::move(other.allocator_);
+        map_allocator_ = map_allocator(allocator_);
+      }
+      take_storage(other);
+    } else if (allocator_ == other.allocator_) {
+      release_storage();
+      take_storage(other);
+    } else {
+      clear();
+      for (auto& value : other) {
+        emplace_back(std::move(value));
+      }
+      other.clear();
+    }
+    return *this;
+  }
+
+  deque& operator=(std::initializer_list<value_type> items) {
+    assign(items.begin(), items.end());
+    return *this;
+  }
+
+  void assign(size_type count, const_reference value) {
+    clear();
+    reserve_back(count);
+    for (; count != 0; --count) {
+      emplace_back(value);
+    }
+  }
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    clear();
+    if constexpr (std::forward_iterator<InputIt>) {
+      reserve_back(static_cast<size_type>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+  void assign(std::initializer_list<value_type> items) {
+    assign(items.begin(), items.end());
+  }
+
+  allocator_type get_allocator() const { return allocator_; }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("deque::at: index out of range");
+    }
+    return (*this)[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("deque::at: index out of range");
+    }
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) { return slot(start_ + pos); }
+  const_reference operator[](size_type pos) const { return slot(start_ + pos); }
+
+  reference front() { return slot(start_); }
+  const_reference front() const { return slot(start_); }
+
+  reference back() { return slot(start_ + size_ - 1); }
+  const_reference back() const { return slot(start_ + size_ - 1); }
+
+  iterator begin() noexcept { return iterator(map_, start_); }
+  const_iterator begin() const noexcept { return cbegin(); }
+  const_iterator cbegin() const noexcept { return const_iterator(iterator(map_, start_)); }
+  iterator end() noexcept { return iterator(map_, start_ + size_); }
+  const_iterator end() const noexcept { return cend(); }
+  const_iterator cend() const noexcept { return const_iterator(iterator(map_, start_ + size_)); }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+  [[nodiscard]] size_type max_size() const noexcept { return alloc_traits::max_size(allocator_); }
+
+  void clear() noexcept {
+    while (size_ != 0) {
+      pop_back();
+    }
+  }
+
+  void resize(size_type count) {
+    while (size_ > count) {
+      pop_back();
+    }
+    reserve_back(count - size_);
+    while (size_ < count) {
+      emplace_back();
+    }
+  }
+  void resize(size_type count, const_reference value) {
+    while (size_ > count) {
+      pop_back();
+    }
+    reserve_back(count - size_);
+    while (size_ < count) {
+      emplace_back(value);
+    }
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type&& value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type&& value) { emplace_front(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    if (start_ + size_ == map_size_ * BlockSize) {
+      grow_map(1, false);
+    }
+    size_type pos = start_ + size_;
+    alloc_traits::construct(allocator_, std::addressof(slot_with_block(pos)), std::forward<Args>(args)...);
+    ++size_;
+    return slot(pos);
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    if (start_ == 0) {
+      grow_map(1, true);
+    }
+    size_type pos = start_ - 1;
+    alloc_traits::construct(allocator_, std::addressof(slot_with_block(pos)), std::forward<Args>(args)...);
+    start_ = pos;
+    ++size_;
+    return slot(pos);
+  }
+
+  void pop_back() noexcept {
+    --size_;
+    size_type pos = start_ + size_;
+    alloc_traits::destroy(allocator_, std::addressof(slot(pos)));
+    if (pos % BlockSize == 0) {
+      release_block(pos / BlockSize);
+    }
+  }
+
+  void pop_front() noexcept {
+    alloc_traits::destroy(allocator_, std::addressof(slot(start_)));
+    ++start_;
+    --size_;
+    if (start_ % BlockSize == 0) {
+      release_block(start_ / BlockSize - 1);
+    }
+  }
+
+  void swap(deque& other) noexcept {
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(allocator_, other.allocator_);
+      std::swap(map_allocator_, other.map_allocator_);
+    }
+    std::swap(map_, other.map_);
+    std::swap(map_size_, other.map_size_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  allocator_type allocator_;
+  map_allocator map_allocator_;
+  map_pointer map_;
+  size_type map_size_;
+  // Absolute slot of front(); slot p lives in block p / BlockSize
+  size_type start_;
+  size_type size_;
+
+  reference slot(size_type pos) const noexcept { return map_[pos / BlockSize][pos % BlockSize]; }
+
+  // The slot at pos, allocating its block first if needed.
+  reference slot_with_block(size_type pos) {
+    block_pointer& block = map_[pos / BlockSize];
+    if (!block) {
+      block = alloc_traits::allocate(allocator_, BlockSize);
+    }
+    return block[pos % BlockSize];
+  }
+
+  void release_block(size_type index) noexcept {
+    if (map_[index]) {
+      alloc_traits::deallocate(allocator_, map_[index], BlockSize);
+      map_[index] = block_pointer();
+    }
+  }
+
+  // Makes room for count more elements at the back with one map regrowth.
+  void reserve_back(size_type count) {
+    size_type end = start_ + size_;
+    if (count > map_size_ * BlockSize - end) {
+      grow_map((count + BlockSize - 1) / BlockSize, false);
+    }
+  }
+
+  // Moves the used blocks into a map with at least extra free block slots
+  // on the requested side, doubling the map if it is more than half full.
+  // Blocks outside the used range are released on the way.
+  void grow_map(size_type extra, bool at_front) {
+    size_type first = start_ / BlockSize;
+    size_type used = size_ == 0 ? 0 : (start_ + size_ - 1) / BlockSize - first + 1;
+    size_type new_size = map_size_;
+    if (new_size < 2 * (used + extra)) {
+      new_size = std::max<size_type>(8, 2 * (used + extra));
+    }
+    // Leave the requested room on the growing side and split the rest evenly
+    size_type spare = new_size - used - extra;
+    size_type offset = at_front ? extra + spare / 2 : spare / 2;
+
+    map_pointer new_map = map_traits::allocate(map_allocator_, new_size);
+    std::uninitialized_fill_n(std::to_address(new_map), new_size, block_pointer());
+    for (size_type i = 0; i < map_size_; ++i) {
+      if (i >= first && i < first + used) {
+        new_map[offset + i - first] = map_[i];
+      } else {
+        release_block(i);
+      }
+    }
+    if (map_) {
+      map_traits::deallocate(map_allocator_, map_, map_size_);
+    }
+    map_ = new_map;
+    map_size_ = new_size;
+    start_ = offset * BlockSize + (size_ == 0 ? 0 : start_ % BlockSize);
+  }
+
+  // Takes other's storage, leaving it empty; *this must own none.
+  void take_storage(deque& other) noexcept {
+    map_ = std::exchange(other.map_, map_pointer());
+    map_size_ = std::exchange(other.map_size_, 0);
+    start_ = std::exchange(other.start_, 0);
+    size_ = std::exchange(other.size_, 0);
+  }
+
+  void release_storage() noexcept {
+    clear();
+    if (map_) {
+      for (size_type i = 0; i < map_size_; ++i) {
+        release_block(i);
+      }
+      map_traits::deallocate(map_allocator_, map_, map_size_);
+    }
+    map_ = map_pointer();
+    map_size_ = start_ = 0;
+  }
+};
+} // namespace s21
+
+#endif // S21_DEQUE_H_
@@ -0,0 +1,478 @@
+#ifndef S21_INDEX_LIST_H_
+#define S21_INDEX_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// A doubly linked list whose nodes live in one s21::vector and link to
+// each other by 32-bit slot indices. A node costs 8 bytes of links plus
+// the value, with no per-node allocation; erased slots go on a free list
+// and are reused by the next insertion. Links do not depend on where the
+// storage is, so copying the list is a copy of the vector, and after
+// compact() the nodes sit in traversal order.
+//
+// Iterators hold a slot index and stay valid until their element is
+// erased or compact() runs. Pointers and references to elements are
+// invalidated whenever an insertion grows the storage.
+template <typename T, typename Allocator = std::allocator<T>>
+class index_list {
+ public:
+  using index_type = std::uint32_t;
+
+ private:
+  // The link past either end of the list
+  static constexpr index_type k_none = std::numeric_limits<index_type>::max();
+  // prev of a slot on the free list
+  static constexpr index_type k_free = k_none - 1;
+  static constexpr bool k_trivial = std::is_trivially_copyable_v<T>;
+
+  // The value is constructed only in live slots. For trivially copyable T
+  // the node is trivially copyable too, so the vector moves it with
+  // memmove.
+  struct node {
+    template <typename... Args>
+    node(index_type prev_index, index_type next_index, std::in_place_t, Args&&... args)
+      : prev(prev_index), next(next_index), value(std::forward<Args>(args)...) {}
+    node(const node&) requires k_trivial = default;
+    node(const node& other) : prev(other.prev), next(other.next) {
+      if (other.live()) {
+        std::construct_at(std::addressof(value), other.value);
+      }
+    }
+    node(node&&) requires k_trivial = default;
+    node(node&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+      : prev(other.prev), next(other.next) {
+      if (other.live()) {
+        std::construct_at(std::addressof(value), std::move(other.value));
+      }
+    }
+    node& operator=(const node&) requires k_trivial = default;
+    node& operator=(const node&) = delete;
+    ~node() requires k_trivial = default;
+    ~node() {
+      if (live()) {
+        std::destroy_at(std::addressof(value));
+      }
+    }
+
+    bool live() const noexcept { return prev != k_free; }
+
+    index_type prev;
+    index_type next;
+    union {
+      T value;
+    };
+  };
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using node_allocator = typename alloc_traits::template rebind_alloc<node>;
+  using storage = s21::vector<node, node_allocator>;
+
+ public:
+  template <bool Const>
+  struct index_iterator {
+    using Self = index_iterator;
+    using list_pointer = std::conditional_t<Const, const index_list*, index_list*>;
+
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    index_iterator() noexcept : list_(nullptr), index_(k_none) {}
+    template <bool OtherConst>
+      requires (Const && !OtherConst)
+    index_iterator(const index_iterator<OtherConst>& other) noexcept
+      : list_(other.list_), index_(other.index_) {}
+
+    reference operator*() const noexcept { return list_->nodes_[index_].value; }
+    pointer operator->() const noexcept { return std::addressof(**this); }
+
+    bool operator==(const Self& rhs) const noexcept = default;
+
+    Self& operator++() noexcept {
+      index_ = list_->nodes_[index_].next;
+      return *this;
+    }
+    Self operator++(int) noexcept {
+      Self tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    Self& operator--() noexcept {
+      index_ = list_->prev_of(index_);
+      return *this;
+    }
+    Self operator--(int) noexcept {
+      Self tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    // The element's slot in the storage; stable until compact().
+    index_type index() const noexcept { return index_; }
+
+   private:
+    index_iterator(list_pointer list, index_type index) noexcept : list_(list), index_(index) {}
+
+    list_pointer list_;
+    index_type index_;
+    friend class index_list;
+    friend struct index_iterator<true>;
+  };
+
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = index_iterator<false>;
+  using const_iterator = index_iterator<true>;
+
+  index_list() noexcept(noexcept(allocator_type())) : index_list(allocator_type()) {}
+  explicit index_list(const allocator_type& alloc) noexcept : nodes_(node_allocator(alloc)) {}
+  explicit index_list(size_type count, const_reference value = value_type(),
+                      const allocator_type& alloc = allocator_type())
+    : index_list(alloc) {
+    reserve(count);
+    for (size_type i = 0; i < count; ++i) {
+      push_back(value);
+    }
+  }
+  template <std::input_iterator It>
+  index_list(It first, It last, const allocator_type& alloc = allocator_type())
+    : index_list(alloc) {
+    if constexpr (std::forward_iterator<It>) {
+      reserve(static_cast<size_type>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+  index_list(std::initializer_list<value_type> items, const allocator_type& alloc = allocator_type())
+    : index_list(items.begin(), items.end(), alloc) {}
+  // Copies the storage as is, free slots included.
+  index_list(const index_list& other)
+    : nodes_(other.nodes_,
+             std::allocator_traits<node_allocator>::select_on_container_copy_construction(
+               other.nodes_.get_allocator())),
+      head_(other.head_), tail_(other.tail_), free_(other.free_), size_(other.size_) {}
+  index_list(index_list&& other) noexcept
+    : nodes_(std::move(other.nodes_)),
+      head_(std::exchange(other.head_, k_none)),
+      tail_(std::exchange(other.tail_, k_none)),
+      free_(std::exchange(other.free_, k_none)),
+      size_(std::exchange(other.size_, 0)) {}
+
+  index_list& operator=(const index_list& other) {
+    if (this != &other) {
+      index_list tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  index_list& operator=(index_list&& other) {
+    if (this != &other) {
+      nodes_ = std::move(other.nodes_);
+      other.nodes_.clear();
+      head_ = std::exchange(other.head_, k_none);
+      tail_ = std::exchange(other.tail_, k_none);
+      free_ = std::exchange(other.free_, k_none);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return allocator_type(nodes_.get_allocator()); }
+
+  reference front() noexcept { return *begin(); }
+  const_reference front() const noexcept { return *begin(); }
+  reference back() noexcept { return *--end(); }
+  const_reference back() const noexcept { return *--end(); }
+
+  iterator begin() noexcept { return iterator(this, head_); }
+  iterator end() noexcept { return iterator(this, k_none); }
+  const_iterator begin() const noexcept { return const_iterator(this, head_); }
+  const_iterator end() const noexcept { return const_iterator(this, k_none); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::min<size_type>(k_free, nodes_.max_size());
+  }
+  // Slots in the storage, live and free.
+  [[nodiscard]] size_type capacity() const noexcept { return nodes_.capacity(); }
+  void reserve(size_type count) { nodes_.reserve(std::min(count, max_size())); }
+
+  // Keeps the storage for reuse.
+  void clear() noexcept {
+    nodes_.clear();
+    head_ = tail_ = free_ = k_none;
+    size_ = 0;
+  }
+
+  // Renumbers the elements into traversal order, 0 to size() - 1, and
+  // frees the unused slots. Invalidates all iterators. The list is left
+  // unchanged if moving a value throws.
+  void compact() {
+    storage packed(nodes_.get_allocator());
+    packed.reserve(size_);
+    index_type index = 0;
+    for (index_type at = head_; at != k_none; at = nodes_[at].next, ++index) {
+      index_type next = index + 1 == size_ ? k_none : index + 1;
+      packed.emplace_back(index == 0 ? k_none : index - 1, next, std::in_place,
+                          std::move_if_noexcept(nodes_[at].value));
+    }
+    nodes_.swap(packed);
+    head_ = size_ == 0 ? k_none : 0;
+    tail_ = size_ == 0 ? k_none : static_cast<index_type>(size_ - 1);
+    free_ = k_none;
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    index_type index = acquire(std::forward<Args>(args)...);
+    link_before(index, pos.index_);
+    ++size_;
+    return iterator(this, index);
+  }
+  iterator insert(const_iterator pos, const_reference value) { return emplace(pos, value); }
+  iterator insert(const_iterator pos, value_type&& value) { return emplace(pos, std::move(value)); }
+
+  // Inserts every argument before pos, in order; returns the last one
+  // inserted.
+  template <typename... Args> requires (std::constructible_from<value_type, Args&&> && ...)
+  iterator insert_many(const_iterator pos, Args&&... args) {
+    iterator result(this, pos.index_);
+    ((result = emplace(pos, std::forward<Args>(args))), ...);
+    return result;
+  }
+
+  iterator erase(const_iterator pos) noexcept {
+    index_type next = nodes_[pos.index_].next;
+    unlink(pos.index_);
+    release(pos.index_);
+    --size_;
+    return iterator(this, next);
+  }
+  iterator erase(const_iterator first, const_iterator last) noexcept {
+    while (first != last) {
+      first = erase(first);
+    }
+    return iterator(this, last.index_);
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    return *emplace(cend(), std::forward<Args>(args)...);
+  }
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type&& value) { emplace_back(std::move(value)); }
+  void pop_back() noexcept { erase(const_iterator(this, tail_)); }
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    return *emplace(cbegin(), std::forward<Args>(args)...);
+  }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type&& value) { emplace_front(std::move(value)); }
+  void pop_front() noexcept { erase(cbegin()); }
+
+  void swap(index_list& other) noexcept(noexcept(std::declval<storage&>().swap(std::declval<storage&>()))) {
+    nodes_.swap(other.nodes_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(free_, other.free_);
+    std::swap(size_, other.size_);
+  }
+
+  // Merges the sorted other into this sorted list; equal elements of this
+  // list come first. The values of other are moved into this storage.
+  template <typename Compare>
+  void merge(index_list& other, Compare comp) {
+    if (this == &other) {
+      return;
+    }
+    const_iterator pos = cbegin();
+    for (auto& value : other) {
+      while (pos != cend() && !comp(value, *pos)) {
+        ++pos;
+      }
+      emplace(pos, std::move(value));
+    }
+    other.clear();
+  }
+  void merge(index_list& other) { merge(other, std::less<>()); }
+
+  // Within one list a splice only relinks, in O(1). Elements of another
+  // list are moved into this storage one by one.
+  void splice(const_iterator pos, index_list& other) {
+    if (this != &other) {
+      splice(pos, other, other.cbegin(), other.cend());
+    }
+  }
+  void splice(const_iterator pos, index_list& other, const_iterator iter) {
+    splice(pos, other, iter, std::next(iter));
+  }
+  void splice(const_iterator pos, index_list& other, const_iterator first, const_iterator last) {
+    if (first == last) {
+      return;
+    }
+    if (this == &other) {
+      if (pos != first && pos != last) {
+        transfer(pos.index_, first.index_, prev_of(last.index_));
+      }
+      return;
+    }
+    for (auto iter = first; iter != last; ++iter) {
+      emplace(pos, std::move(other.nodes_[iter.index_].value));
+    }
+    other.erase(first, last);
+  }
+
+  void reverse() noexcept {
+    for (index_type index = head_; index != k_none;) {
+      node& current = nodes_[index];
+      std::swap(current.prev, current.next);
+      index = current.prev;
+    }
+    std::swap(head_, tail_);
+  }
+
+  template <typename BinaryPredicate>
+  void unique(BinaryPredicate equal) {
+    if (size_ < 2) {
+      return;
+    }
+    const_iterator write = cbegin();
+    for (const_iterator read = std::next(write); read != cend();) {
+      if (equal(*write, *read)) {
+        read = erase(read);
+      } else {
+        write = read++;
+      }
+    }
+  }
+  void unique() { unique(std::equal_to<>()); }
+
+  // Stable. Sorts the slot indices, in a buffer from the list's allocator,
+  // and relinks them; values stay in their slots. If comp throws the list
+  // is unchanged.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) {
+      return;
+    }
+    using order_allocator = typename alloc_traits::template rebind_alloc<index_type>;
+    s21::vector<index_type, order_allocator> order{order_allocator(nodes_.get_allocator())};
+    order.reserve(size_);
+    for (index_type index = head_; index != k_none; index = nodes_[index].next) {
+      order.push_back(index);
+    }
+    std::stable_sort(order.data(), order.data() + order.size(), [&](index_type lhs, index_type rhs) {
+      return comp(nodes_[lhs].value, nodes_[rhs].value);
+    });
+    index_type before = k_none;
+    for (index_type index : order) {
+      nodes_[index].prev = before;
+      next_link(before) = index;
+      before = index;
+    }
+    nodes_[before].next = k_none;
+    tail_ = before;
+  }
+  void sort() { sort(std::less<>()); }
+
+ private:
+  // Constructs a value in a free slot, or a new one at the end of the
+  // storage, and returns its index unlinked.
+  template <typename... Args>
+  index_type acquire(Args&&... args) {
+    if (free_ != k_none) {
+      index_type index = free_;
+      node& slot = nodes_[index];
+      index_type next_free = slot.next;
+      std::construct_at(std::addressof(slot.value), std::forward<Args>(args)...);
+      slot.prev = k_none;
+      free_ = next_free;
+      return index;
+    }
+    if (nodes_.size() >= max_size()) {
+      throw std::length_error("index_list: too many elements");
+    }
+    nodes_.emplace_back(k_none, k_none, std::in_place, std::forward<Args>(args)...);
+    return static_cast<index_type>(nodes_.size() - 1);
+  }
+
+  void release(index_type index) noexcept {
+    node& slot = nodes_[index];
+    std::destroy_at(std::addressof(slot.value));
+    slot.prev = k_free;
+    slot.next = free_;
+    free_ = index;
+  }
+
+  index_type prev_of(index_type pos) const noexcept {
+    return pos == k_none ? tail_ : nodes_[pos].prev;
+  }
+  // The link that points forward into index, or back into it.
+  index_type& next_link(index_type before) noexcept {
+    return before == k_none ? head_ : nodes_[before].next;
+  }
+  index_type& prev_link(index_type after) noexcept {
+    return after == k_none ? tail_ : nodes_[after].prev;
+  }
+
+  void link_before(index_type index, index_type pos) noexcept {
+    index_type before = prev_of(pos);
+    nodes_[index].prev = before;
+    nodes_[index].next = pos;
+    next_link(before) = index;
+    prev_link(pos) = index;
+  }
+  void unlink(index_type index) noexcept {
+    node& target = nodes_[index];
+    next_link(target.prev) = target.next;
+    prev_link(target.next) = target.prev;
+  }
+
+  // Moves the run first..last of this list before pos, which is neither in
+  // it nor just after it.
+  void transfer(index_type pos, index_type first, index_type last) noexcept {
+    index_type before = nodes_[first].prev;
+    index_type after = nodes_[last].next;
+    next_link(before) = after;
+    prev_link(after) = before;
+
+    before = prev_of(pos);
+    nodes_[first].prev = before;
+    nodes_[last].next = pos;
+    next_link(before) = first;
+    prev_link(pos) = last;
+  }
+
+  storage nodes_;
+  index_type head_ = k_none;
+  index_type tail_ = k_none;
+  index_type free_ = k_none;
+  size_type size_ = 0;
+};
+} // namespace s21
+
+#endif // S21_INDEX_LIST_H_
@@ -0,0 +1,247 @@
+#ifndef S21_INTRUSIVE_LIST_H_
+#define S21_INTRUSIVE_LIST_H_
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "s21_list.h"
+
+namespace s21 {
+// The links an object embeds to be put in an intrusive_list. A hook
+// belongs to one list at a time; copying an object gives the copy an
+// unlinked hook. The owner must remove the object from its list before
+// destroying it.
+struct intrusive_list_hook : list_details::list_node_base {
+  intrusive_list_hook() noexcept = default;
+  intrusive_list_hook(const intrusive_list_hook&) noexcept {}
+  intrusive_list_hook& operator=(const intrusive_list_hook&) noexcept { return *this; }
+
+  [[nodiscard]] bool is_linked() const noexcept { return next != this; }
+};
+
+// A doubly linked list of objects that carry their own links in the
+// member Hook, so inserting and removing never allocate and an element is
+// found from a reference to it in O(1) (iterator_to). The list does not
+// own its elements: clearing or destroying it only unlinks them.
+template <typename T, intrusive_list_hook T::*Hook>
+class intrusive_list {
+  using node_base = list_details::list_node_base;
+
+  static node_base* hook_of(const T& value) noexcept {
+    return const_cast<intrusive_list_hook*>(&(value.*Hook));
+  }
+  // Hook's offset inside T. Under the Itanium C++ ABI, which GCC and Clang
+  // follow outside Windows and announce with __GXX_ABI_VERSION, a pointer
+  // to data member is represented as exactly that offset. std::bit_cast of
+  // it is not a constant expression, but it folds to one. Elsewhere the
+  // offset is measured on suitably aligned local storage, which the
+  // compiler folds the same way.
+  static std::ptrdiff_t hook_offset() noexcept {
+#if defined(__GXX_ABI_VERSION)
+    static_assert(sizeof(Hook) == sizeof(std::ptrdiff_t),
+                  "the Itanium ABI stores a pointer to data member as an offset");
+    return std::bit_cast<std::ptrdiff_t>(Hook);
+#else
+    alignas(T) unsigned char probe[sizeof(T)];
+    const T* sample = reinterpret_cast<const T*>(probe);
+    return reinterpret_cast<const unsigned char*>(&(sample->*Hook)) - probe;
+#endif
+  }
+  static T* owner_of(const node_base* hook) noexcept {
+    auto* bytes = reinterpret_cast<unsigned char*>(
+      const_cast<intrusive_list_hook*>(static_cast<const intrusive_list_hook*>(hook)));
+    return reinterpret_cast<T*>(bytes - hook_offset());
+  }
+
+ public:
+  template <bool Const>
+  struct intrusive_iterator {
+    using Self = intrusive_iterator;
+
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    intrusive_iterator() noexcept : current_(nullptr) {}
+    template <bool OtherConst>
+      requires (Const && !OtherConst)
+    intrusive_iterator(const intrusive_iterator<OtherConst>& other) noexcept
+      : current_(other.current_) {}
+
+    reference operator*() const noexcept { return *owner_of(current_); }
+    pointer operator->() const noexcept { return owner_of(current_); }
+
+    bool operator==(const Self& rhs) const noexcept = default;
+
+    Self& operator++() noexcept {
+      current_ = current_->next;
+      return *this;
+    }
+    Self operator++(int) noexcept {
+      Self tmp(*this);
+      current_ = current_->next;
+      return tmp;
+    }
+    Self& operator--() noexcept {
+      current_ = current_->prev;
+      return *this;
+    }
+    Self operator--(int) noexcept {
+      Self tmp(*this);
+      current_ = current_->prev;
+      return tmp;
+    }
+
+   private:
+    explicit intrusive_iterator(const node_base* node) noexcept
+      : current_(const_cast<node_base*>(node)) {}
+
+    node_base* current_;
+    friend class intrusive_list;
+    friend struct intrusive_iterator<true>;
+  };
+
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = intrusive_iterator<false>;
+  using const_iterator = intrusive_iterator<true>;
+
+  intrusive_list() noexcept = default;
+  intrusive_list(const intrusive_list&) = delete;
+  intrusive_list& operator=(const intrusive_list&) = delete;
+  intrusive_list(intrusive_list&& other) noexcept { splice(cend(), other); }
+  intrusive_list& operator=(intrusive_list&& other) noexcept {
+    if (this != &other) {
+      clear();
+      splice(cend(), other);
+    }
+    return *this;
+  }
+  ~intrusive_list() { clear(); }
+
+  reference front() noexcept { return *begin(); }
+  const_reference front() const noexcept { return *begin(); }
+  reference back() noexcept { return *--end(); }
+  const_reference back() const noexcept { return *--end(); }
+
+  iterator begin() noexcept { return iterator(sentinel_.next); }
+  iterator end() noexcept { return iterator(&sentinel_); }
+  const_iterator begin() const noexcept { return const_iterator(sentinel_.next); }
+  const_iterator end() const noexcept { return const_iterator(&sentinel_); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+
+  // value must be in this list.
+  iterator iterator_to(reference value) noexcept { return iterator(hook_of(value)); }
+  const_iterator iterator_to(const_reference value) const noexcept { return const_iterator(hook_of(value)); }
+
+  // Unlinks every element, leaving their hooks unlinked.
+  void clear() noexcept {
+    while (!empty()) {
+      pop_back();
+    }
+  }
+
+  // value must not be in a list.
+  iterator insert(const_iterator pos, reference value) noexcept {
+    node_base* hook = hook_of(value);
+    hook->link_before(pos.current_);
+    ++size_;
+    return iterator(hook);
+  }
+  iterator erase(const_iterator pos) noexcept {
+    node_base* next = pos.current_->next;
+    pos.current_->unlink();
+    --size_;
+    return iterator(next);
+  }
+  iterator erase(const_iterator first, const_iterator last) noexcept {
+    while (first != last) {
+      first = erase(first);
+    }
+    return iterator(last.current_);
+  }
+  // Unlinks value, which must be in this list.
+  void remove(reference value) noexcept { erase(iterator_to(value)); }
+
+  void push_back(reference value) noexcept { insert(cend(), value); }
+  void push_front(reference value) noexcept { insert(cbegin(), value); }
+  void pop_back() noexcept { erase(const_iterator(sentinel_.prev)); }
+  void pop_front() noexcept { erase(cbegin()); }
+
+  void swap(intrusive_list& other) noexcept {
+    node_base::swap_sentinels(sentinel_, other.sentinel_);
+    std::swap(size_, other.size_);
+  }
+
+  // O(1) for a whole list or a single element; a range from another list
+  // is counted first.
+  void splice(const_iterator pos, intrusive_list& other) noexcept {
+    if (this != &other && !other.empty()) {
+      transfer(pos, other, other.cbegin(), other.cend(), other.size_);
+    }
+  }
+  void splice(const_iterator pos, intrusive_list& other, const_iterator iter) noexcept {
+    auto last = std::next(iter);
+    if (pos != iter && pos != last) {
+      transfer(pos, other, iter, last, 1);
+    }
+  }
+  void splice(const_iterator pos, intrusive_list& other,
+              const_iterator first, const_iterator last) noexcept {
+    if (first != last) {
+      size_type count = this == &other ? 0 : static_cast<size_type>(std::distance(first, last));
+      transfer(pos, other, first, last, count);
+    }
+  }
+
+  void reverse() noexcept {
+    node_base* node = &sentinel_;
+    do {
+      node->reverse();
+      node = node->prev;
+    } while (node != &sentinel_);
+  }
+
+  // Stable, relinks hooks only. If comp throws the list keeps all its
+  // elements in an unspecified order.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ > 1) {
+      list_details::sort_ring(sentinel_, [&comp](node_base* lhs, node_base* rhs) {
+        return comp(*owner_of(lhs), *owner_of(rhs));
+      });
+    }
+  }
+  void sort() { sort(std::less<>()); }
+
+ private:
+  void transfer(const_iterator pos, intrusive_list& other,
+                const_iterator first, const_iterator last, size_type count) noexcept {
+    node_base* first_node = first.current_;
+    node_base* last_node = last.current_->prev;
+    node_base::unlink_group(first_node, last_node);
+    pos.current_->link_group_before(first_node, last_node);
+    other.size_ -= count;
+    size_ += count;
+  }
+
+  node_base sentinel_;
+  size_type size_ = 0;
+};
+} // namespace s21
+
+#endif // S21_INTRUSIVE_LIST_H_
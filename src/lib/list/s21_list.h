@@ -1,8 +1,15 @@
 #ifndef S21_LIST_H_
 #define S21_LIST_H_
 
+#include <concepts>
+#include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <utility>
+
+#include "../allocator/s21_node_pool_allocator.h"
 
 namespace s21 {
 namespace list_details {
@@ -41,6 +48,12 @@ struct list_node_base {
     std::swap(lhs->prev, rhs->prev);
     std::swap(lhs->next, rhs->next);
   }
+  // Exchanges the chains hanging off two sentinels.
+  static void swap_sentinels(list_node_base &lhs, list_node_base &rhs) noexcept {
+    swap(&lhs, &rhs);
+    lhs.adopt_chain(rhs);
+    rhs.adopt_chain(lhs);
+  }
   void reverse() {
     std::swap(next, prev);
   }
@@ -50,6 +63,133 @@ struct list_node_base {
     next = this;
     prev = this;
   }
+  // Points the ends of the chain just swapped in back at this sentinel;
+  // other was the sentinel the chain used to hang off.
+  void adopt_chain(list_node_base &other) noexcept {
+    if (next == &other) {
+      init();
+    } else {
+      next->prev = this;
+      prev->next = this;
+    }
+  }
+};
+
+// Merges the null-terminated chain other, linked through next only, into
+// the sorted chain into. Ties keep the nodes of into first. If less throws,
+// into still holds every node of both chains, in no particular order.
+template <typename Less>
+void merge_chains(list_node_base *&into, list_node_base *other, Less &less) {
+  list_node_base head;
+  list_node_base *tail = &head;
+  list_node_base *first = into;
+  try {
+    while (first && other) {
+      if (less(other, first)) {
+        tail->next = other;
+        other = other->next;
+      } else {
+        tail->next = first;
+        first = first->next;
+      }
+      tail = tail->next;
+    }
+  } catch (...) {
+    tail->next = first;
+    while (tail->next) {
+      tail = tail->next;
+    }
+    tail->next = other;
+    into = head.next;
+    throw;
+  }
+  tail->next = first ? first : other;
+  into = head.next;
+}
+
+// Stable bottom-up merge sort of a null-terminated chain linked through
+// next: bins[i] holds a sorted run of 2^i nodes, and every node merges
+// upwards through the occupied bins like a binary counter. Only next
+// links are touched; the caller restores prev. If less throws, chain
+// still holds every node.
+template <typename Less>
+void sort_chain(list_node_base *&chain, Less less) {
+  list_node_base *bins[64] = {};
+  list_node_base *rest = chain;
+  chain = nullptr;
+  try {
+    while (rest) {
+      list_node_base *run = rest;
+      rest = rest->next;
+      run->next = nullptr;
+      std::size_t i = 0;
+      for (; bins[i]; ++i) {
+        merge_chains(bins[i], run, less);
+        run = std::exchange(bins[i], nullptr);
+      }
+      bins[i] = run;
+    }
+    // Higher bins hold earlier nodes
+    for (auto *&bin : bins) {
+      if (bin) {
+        if (chain) {
+          merge_chains(bin, std::exchange(chain, nullptr), less);
+        }
+        chain = std::exchange(bin, nullptr);
+      }
+    }
+  } catch (...) {
+    list_node_base head;
+    head.next = chain;
+    list_node_base *tail = &head;
+    for (list_node_base *part : bins) {
+      while (tail->next) {
+        tail = tail->next;
+      }
+      tail->next = part;
+    }
+    while (tail->next) {
+      tail = tail->next;
+    }
+    tail->next = rest;
+    chain = head.next;
+    throw;
+  }
+}
+
+// Rebuilds the prev links of a null-terminated chain and closes it into a
+// ring around sentinel.
+inline void close_ring(list_node_base &sentinel, list_node_base *chain) noexcept {
+  list_node_base *prev = &sentinel;
+  for (auto *node = chain; node; node = node->next) {
+    node->prev = prev;
+    prev->next = node;
+    prev = node;
+  }
+  prev->next = &sentinel;
+  sentinel.prev = prev;
+}
+
+// Sorts the non-empty ring of nodes around sentinel with sort_chain. If
+// less throws, the ring keeps every node in an unspecified order.
+template <typename Less>
+void sort_ring(list_node_base &sentinel, Less less) {
+  list_node_base *chain = sentinel.next;
+  sentinel.prev->next = nullptr;
+  try {
+    sort_chain(chain, less);
+  } catch (...) {
+    close_ring(sentinel, chain);
+    throw;
+  }
+  close_ring(sentinel, chain);
+}
+
+// Allocators that can hand out a run of nodes in one contiguous block
+// while still letting every node be deallocated on its own.
+template <typename Alloc>
+concept contiguous_node_allocator = requires(Alloc& alloc, std::size_t count) {
+  { alloc.allocate_contiguous(count) } -> std::same_as<typename std::allocator_traits<Alloc>::pointer>;
 };
 } // namespace list_details
 
@@ -66,8 +206,9 @@ class list {
   struct list_node : public list_details::list_node_base {
     T data;
 
-    explicit list_node(const T &value)
-      : data(value) {}
+    template <typename... Args>
+    explicit list_node(Args&&... args)
+      : data(std::forward<Args>(args)...) {}
     
     list_node_base *ptr() noexcept {
       return this;
@@ -222,24 +363,22 @@ class list {
   using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<list_node>;
   
   list() : list(Allocator()) {};
-  explicit list(const Allocator& alloc) : allocator_(alloc) { init(); }
+  explicit list(const Allocator& alloc) noexcept : allocator_(alloc) {}
   explicit list(size_type count, const_reference value = value_type(),
                 const Allocator& alloc = Allocator()) : allocator_(alloc) {
-    init();
-    for (size_type i = 0; i < count; ++i) {
-      push_back(value);
-    }
+    construct_with([&] {
+      insert_chain(&sentinel_, count, [&](list_node *node) { construct_node(node, value); });
+    });
+  }
+  template <std::input_iterator It>
+  list(It first, It last, const Allocator& alloc = Allocator()) : allocator_(alloc) {
+    construct_with([&] { insert_range(&sentinel_, first, last); });
   }
   list(std::initializer_list<value_type> const &items,
        const Allocator& alloc = Allocator()) : allocator_(alloc) {
-    init();
-    for (const auto &value : items) {
-      push_back(value);
-    }
+    construct_with([&] { insert_range(&sentinel_, items.begin(), items.end()); });
   }
-  list(const list &other) {
-    this->allocator_ = other.allocator_;
-    this->init();
+  list(const list &other) : allocator_(other.allocator_) {
     for (auto &value : other) {
       this->push_back(value);
     }
@@ -249,21 +388,22 @@ class list {
       this->push_back(value);
     }
   }
-  list(list &&other) {
-    this->allocator_ = std::move(other.allocator_);
-    this->init();
-    if (!other.empty()) {
-      this->splice(this->cbegin(), other);
-    }
+  list(list &&other) noexcept : allocator_(std::move(other.allocator_)) {
+    this->splice(this->cbegin(), other);
   }
   list(list &&other, const Allocator& alloc) : list(alloc) {
-    if (!other.empty()) {
+    if (allocator_ != other.allocator_) {
+      // Nodes cannot change allocators, move the values instead
+      for (auto &value : other) {
+        this->emplace_back(std::move(value));
+      }
+      other.clear();
+    } else if (!other.empty()) {
       this->splice(this->cbegin(), other);
     }
   }
   ~list() noexcept {
     clear();
-    destroy_node(head_);
   }
   list& operator=(const list& other) {
     if (this != &other) {
@@ -275,24 +415,44 @@ class list {
   constexpr list &operator=(list &&other) {
     this->clear();
     if (static_cast<bool>(std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value)) {
-      auto node = static_cast<list_node*>(this->end().current_);
-      destroy_node(node, false);
       this->allocator_ = std::move(other.allocator_);
-      init();
     }
     this->splice(this->cbegin(), other);
     return *this;
   }
 
+  // Assigns over the existing elements first, then erases the surplus or
+  // appends the rest in one chain.
+  void assign(size_type count, const_reference value) {
+    auto iter = begin();
+    for (; iter != end() && count != 0; ++iter, --count) {
+      *iter = value;
+    }
+    erase_to_end(iter);
+    insert_chain(&sentinel_, count, [&](list_node *node) { construct_node(node, value); });
+  }
+  template <std::input_iterator It>
+  void assign(It first, It last) {
+    auto iter = begin();
+    for (; iter != end() && first != last; ++iter, ++first) {
+      *iter = *first;
+    }
+    erase_to_end(iter);
+    insert_range(&sentinel_, first, last);
+  }
+  void assign(std::initializer_list<value_type> items) {
+    assign(items.begin(), items.end());
+  }
+
   const_reference front() const noexcept { return *begin(); }
   const_reference back() const noexcept { return *(--end()); }
 
-  iterator begin() noexcept { return iterator(head_); }
-  iterator end() noexcept { return iterator(tail_); }
-  const_iterator begin() const noexcept { return const_iterator(head_); }
-  const_iterator end() const noexcept { return const_iterator(tail_); }
-  const_iterator cbegin() const noexcept { return const_iterator(head_); }
-  const_iterator cend() const noexcept { return const_iterator(tail_); }
+  iterator begin() noexcept { return iterator(sentinel_.next); }
+  iterator end() noexcept { return iterator(&sentinel_); }
+  const_iterator begin() const noexcept { return const_iterator(sentinel_.next); }
+  const_iterator end() const noexcept { return const_iterator(&sentinel_); }
+  const_iterator cbegin() const noexcept { return const_iterator(sentinel_.next); }
+  const_iterator cend() const noexcept { return const_iterator(&sentinel_); }
 
   [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
   [[nodiscard]] size_type size() const noexcept { return size_; }
@@ -305,31 +465,32 @@ class list {
       pop_back();
     }
   }
+  // Builds the value inside the new node from args.
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    return iterator(emplace_before(pos.non_const().current_, std::forward<Args>(args)...));
+  }
   iterator insert(iterator pos, const_reference value) {
-    auto *node = create_node(value);
-    node->ptr()->link_before(pos.current_);
-    ++size_;
-    if (pos == begin()) {
-      head_ = node;
-    }
-    iterator iter(node);
-    return iter;
+    return iterator(emplace_before(pos.current_, value));
+  }
+  iterator insert(iterator pos, value_type &&value) {
+    return iterator(emplace_before(pos.current_, std::move(value)));
   }
 
-  template<typename... Args> requires (std::same_as<value_type, Args> && ...)
+  // Inserts every argument before pos, in order, moving rvalues; returns
+  // the last one inserted.
+  template<typename... Args> requires (std::constructible_from<value_type, Args&&> && ...)
   iterator insert_many(const_iterator pos, Args&& ...args) {
-    iterator iter = pos.non_const();
-    iterator res = (insert(iter, std::forward<Args>(args)), ...);
-    return res;
+    auto *before = pos.non_const().current_;
+    list_node *node = nullptr;
+    ((node = emplace_before(before, std::forward<Args>(args))), ...);
+    return iterator(node ? node : before);
   }
 
   iterator erase(iterator pos) noexcept {
     if (pos == end()) {
       return end();
     }
-    if (pos == begin()) {
-      head_ = static_cast<list_node*>(head_->ptr()->next);
-    }
     iterator to_return = pos;
     ++to_return;
     auto *node = pos.current_;
@@ -339,48 +500,52 @@ class list {
     return to_return;
   }
   void push_back(const_reference value) {
-    auto *node = create_node(value);
-    node->ptr()->link_before(tail_);
-    if (this->empty()) {
-      head_ = node;
-    }
-    ++size_;
+    emplace_before(&sentinel_, value);
+  }
+  void push_back(value_type &&value) {
+    emplace_before(&sentinel_, std::move(value));
+  }
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    return emplace_before(&sentinel_, std::forward<Args>(args)...)->data;
   }
   void pop_back() noexcept {
     if (empty()) {
       return;
     }
-    auto *node = tail_->prev;
+    auto *node = sentinel_.prev;
     node->unlink();
     destroy_node(static_cast<list_node*>(node));
     --size_;
-    if (size_ == 0) {
-      head_ = tail_;
-    }
   }
   void push_front(const_reference value) {
-    auto *node = create_node(value);
-    node->ptr()->link_before(head_);
-    head_ = node;
-    ++size_;
+    emplace_before(sentinel_.next, value);
+  }
+  void push_front(value_type &&value) {
+    emplace_before(sentinel_.next, std::move(value));
+  }
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    return emplace_before(sentinel_.next, std::forward<Args>(args)...)->data;
   }
   void pop_front() noexcept {
     if (empty()) {
       return;
     }
-    auto *node = head_;
-    head_ = static_cast<list_node*>(head_->ptr()->next);
+    auto *node = sentinel_.next;
     node->unlink();
-    destroy_node(node);
+    destroy_node(static_cast<list_node*>(node));
     --size_;
   }
   void swap(list &other) {
     if (&other == this) {
       return;
     }
-    std::swap(this->head_, other.head_);
-    std::swap(this->tail_, other.tail_);
+    list_details::list_node_base::swap_sentinels(this->sentinel_, other.sentinel_);
     std::swap(this->size_, other.size_);
+    if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_swap::value) {
+      std::swap(this->allocator_, other.allocator_);
+    }
   }
   void merge(list &other) {
     if (&other == this) {
@@ -396,46 +561,34 @@ class list {
         ++iter1;
       }
     }
-    if (iter2 != other.cend()) {
-      this->splice(this->cend(), other, iter2, other.cend());
-    }
+    // What is left of other goes after every element of this list
+    this->splice(this->cend(), other);
     other.clear();
   }
 
+  // Whole lists and single nodes move in O(1); a range from another list
+  // is counted first, a range within this list is not.
   void splice(const_iterator pos, list &other) {
-    splice(pos, other, other.cbegin(), other.cend());
+    if (&other != this && !other.empty()) {
+      transfer(pos, other, other.cbegin(), other.cend(), other.size_);
+    }
   }
   void splice(const_iterator pos, list &other,
               const_iterator iter) {
     auto last = iter;
     ++last;
-    splice(pos, other, iter, last);
+    if (pos == iter || pos == last) {
+      return;
+    }
+    transfer(pos, other, iter, last, 1);
   }
   void splice(const_iterator pos, list &other,
     const_iterator first, const_iterator last) {
     if (first == last) {
       return;
     }
-
-    auto diff = std::distance(first, last);
-    auto* node = static_cast<list_node*>(const_cast<list_details::list_node_base*>(pos.current_));
-    auto* last_to_insert = const_cast<list_details::list_node_base*>(last.current_->prev);
-
-    if (other.head_ == static_cast<list_node*>(const_cast<list_details::list_node_base*>(first.current_))) {
-      other.head_ = static_cast<list_node*>(const_cast<list_details::list_node_base*>(last.current_));
-    }
-    list_details::list_node_base::unlink_group(
-      const_cast<list_details::list_node_base*>(first.current_),
-      const_cast<list_details::list_node_base*>(last.current_->prev));
-    
-    node->link_group_before(
-      const_cast<list_details::list_node_base*>(first.current_), last_to_insert);
-
-    if (node == this->head_) {
-      this->head_ = static_cast<list_node*>(const_cast<list_details::list_node_base*>(first.current_));
-    }
-    other.size_ -= diff;
-    size_ += diff;
+    size_type count = &other == this ? 0 : static_cast<size_type>(std::distance(first, last));
+    transfer(pos, other, first, last, count);
   }
 
   void reverse() {
@@ -448,7 +601,6 @@ class list {
       --iter;
     }
     iter.current_->reverse();
-    head_ = static_cast<list_node*>(iter.current_->next);
   }
   void unique() {
     if (empty()) {
@@ -466,40 +618,137 @@ class list {
       }
     }
   }
-  void sort() {
-    if (size() <= 1) return;
-  
-    list left(allocator_);
-    list right(allocator_);
-
-    size_type half_size = size() / 2;
-    auto mid = cbegin();
-    std::advance(mid, half_size);
-
-    left.splice(left.cbegin(), *this, cbegin(), mid);
-    right.splice(right.cbegin(), *this);
-
-    left.sort();
-    right.sort();
-
-    left.merge(right);
-    *this = std::move(left);
+  // Stable, relinks nodes only and allocates nothing. If comp throws the
+  // list keeps all its elements in an unspecified order.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size() <= 1) {
+      return;
+    }
+    auto less = [&comp](list_details::list_node_base *lhs, list_details::list_node_base *rhs) {
+      return comp(static_cast<list_node*>(lhs)->data, static_cast<list_node*>(rhs)->data);
+    };
+    list_details::sort_ring(sentinel_, less);
   }
+  void sort() { sort(std::less<>()); }
 
 #ifdef TESTS
  public:
 #else
  private:
 #endif
-  list_node *head_, *tail_;
-  size_type size_;
+  // Embedded, so an empty list owns no memory
+  list_details::list_node_base sentinel_;
+  size_type size_ = 0;
   allocator_type allocator_;
   friend struct list_iterator;
 
-  list_node* create_node(const_reference value) {
+  template <typename... Args>
+  void construct_node(list_node *node, Args&&... args) {
+    std::allocator_traits<allocator_type>::construct(allocator_, node, std::forward<Args>(args)...);
+  }
+
+  // Creates a node from args and links it before pos.
+  template <typename... Args>
+  list_node* emplace_before(list_details::list_node_base *pos, Args&&... args) {
+    auto *node = create_node(std::forward<Args>(args)...);
+    node->ptr()->link_before(pos);
+    ++size_;
+    return node;
+  }
+
+  // Builds count nodes with make(node) and links them before pos in a
+  // single splice. With a contiguous_node_allocator the nodes come from
+  // one block, so they are laid out in list order.
+  template <typename Make>
+  void insert_chain(list_details::list_node_base *pos, size_type count, Make make) {
+    if (count == 0) {
+      return;
+    }
+    list_node *block = nullptr;
+    if constexpr (list_details::contiguous_node_allocator<allocator_type>) {
+      block = allocator_.allocate_contiguous(count);
+    }
+    list_node *first = nullptr;
+    list_node *last = nullptr;
+    size_type built = 0;
+    try {
+      for (; built < count; ++built) {
+        list_node *node = block ? block + built
+          : std::allocator_traits<allocator_type>::allocate(allocator_, 1);
+        try {
+          make(node);
+        } catch (...) {
+          if (!block) {
+            destroy_node(node, false);
+          }
+          throw;
+        }
+        if (last) {
+          last->next = node;
+          node->prev = last;
+        } else {
+          first = node;
+        }
+        last = node;
+      }
+    } catch (...) {
+      for (list_node *node = first; built != 0; --built) {
+        auto *next = static_cast<list_node*>(node->next);
+        destroy_node(node);
+        node = next;
+      }
+      if (block) {
+        for (list_node *node = last ? last + 1 : block; node != block + count; ++node) {
+          destroy_node(node, false);
+        }
+      }
+      throw;
+    }
+    pos->link_group_before(first, last);
+    size_ += count;
+  }
+
+  // Forward ranges are counted and linked as one chain.
+  template <typename It>
+  void insert_range(list_details::list_node_base *pos, It first, It last) {
+    if constexpr (std::forward_iterator<It>) {
+      auto count = static_cast<size_type>(std::distance(first, last));
+      insert_chain(pos, count, [&](list_node *node) {
+        construct_node(node, *first);
+        ++first;
+      });
+    } else {
+      for (; first != last; ++first) {
+        emplace_before(pos, *first);
+      }
+    }
+  }
+
+  // Moves the count nodes of [first, last) from other before pos.
+  void transfer(const_iterator pos, list &other,
+                const_iterator first, const_iterator last, size_type count) noexcept {
+    auto* node = const_cast<list_details::list_node_base*>(pos.current_);
+    auto* first_node = const_cast<list_details::list_node_base*>(first.current_);
+    auto* last_node = const_cast<list_details::list_node_base*>(last.current_->prev);
+
+    list_details::list_node_base::unlink_group(first_node, last_node);
+    node->link_group_before(first_node, last_node);
+    other.size_ -= count;
+    size_ += count;
+  }
+
+  void erase_to_end(iterator iter) noexcept {
+    while (iter != end()) {
+      iter = erase(iter);
+    }
+  }
+
+  template <typename... Args>
+  list_node* create_node(Args&&... args) {
     list_node* new_node = std::allocator_traits<allocator_type>::allocate(allocator_, 1);
     try {
-      std::allocator_traits<allocator_type>::construct(allocator_, new_node, value);
+      construct_node(new_node, std::forward<Args>(args)...);
     } catch (...) {
       std::allocator_traits<allocator_type>::deallocate(allocator_, new_node, 1);
       throw;
@@ -514,13 +763,23 @@ class list {
     std::allocator_traits<allocator_type>::deallocate(allocator_, node, 1);
   }
 
-  void init() noexcept {
-    head_ = tail_ = std::allocator_traits<allocator_type>::allocate(allocator_, 1);
-    // memset(&(head_->data), 0, sizeof(value_type));
-    tail_->ptr()->next = tail_->ptr()->prev = tail_;
-    size_ = 0;
+  // Runs fill() for a constructor, freeing what it built if it throws:
+  // the destructor does not run for a constructor that throws.
+  template <typename Fill>
+  void construct_with(Fill fill) {
+    try {
+      fill();
+    } catch (...) {
+      clear();
+      throw;
+    }
   }
 };
+
+// A list whose nodes are carved from slabs shared by the list and its
+// copies, see node_pool_allocator.
+template <typename T>
+using pool_list = list<T, node_pool_allocator<T>>;
 } // namespace s21
 
 #endif // S21_LIST_H_
\ No newline at end of file
@@ -1,10 +1,10 @@
 #ifndef S21_QUEUE_H_
 #define S21_QUEUE_H_
 
-#include <deque>
+#include "../deque/s21_deque.h"
 
 namespace s21 {
-template <typename T, typename Container = std::deque<T>>
+template <typename T, typename Container = s21::deque<T>>
 class queue {
   using value_type = T;
   using reference = T&;
@@ -0,0 +1,214 @@
+#ifndef S21_RING_BUFFER_H_
+#define S21_RING_BUFFER_H_
+
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// A bounded FIFO over one contiguous allocation. The capacity is fixed at
+// construction and rounded up to a power of two, so slots are found by
+// masking the free-running head and tail counters. Pushing into a full
+// buffer throws std::length_error. It provides what s21::queue needs from
+// its Container:
+//
+//   s21::queue<packet, s21::ring_buffer<packet>> packets(s21::ring_buffer<packet>(1024));
+template <typename T, typename Allocator = std::allocator<T>>
+class ring_buffer {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = typename alloc_traits::pointer;
+  using const_pointer = typename alloc_traits::const_pointer;
+
+  ring_buffer() noexcept(noexcept(allocator_type())) : ring_buffer(allocator_type()) {}
+
+  explicit ring_buffer(const allocator_type& alloc) noexcept
+    : allocator_(alloc), data_(), capacity_(0), head_(0), tail_(0) {}
+
+  explicit ring_buffer(size_type capacity, const allocator_type& alloc = allocator_type())
+    : ring_buffer(alloc) {
+    create_storage(capacity);
+  }
+
+  ring_buffer(std::initializer_list<value_type> const& items, const allocator_type& alloc = allocator_type())
+    : ring_buffer(items.size(), alloc) {
+    for (const auto& item : items) {
+      emplace_back(item);
+    }
+  }
+
+  ring_buffer(const ring_buffer& other)
+    : ring_buffer(other.capacity_, alloc_traits::select_on_container_copy_construction(other.allocator_)) {
+    copy_elements(other);
+  }
+
+  ring_buffer(ring_buffer&& other) noexcept : ring_buffer(other.allocator_) {
+    take_storage(other);
+  }
+
+  ~ring_buffer() {
+    release_storage();
+  }
+
+  ring_buffer& operator=(const ring_buffer& other) {
+    if (this != &other) {
+      clear();
+      if (capacity_ != other.capacity_) {
+        release_storage();
+        create_storage(other.capacity_);
+      }
+      copy_elements(other);
+    }
+    return *this;
+  }
+
+  ring_buffer& operator=(ring_buffer&& other)
+    noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+             alloc_traits::is_always_equal::value) {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value ||
+                  alloc_traits::is_always_equal::value) {
+      release_storage();
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+        allocator_ = std::move(other.allocator_);
+      }
+      take_storage(other);
+    } else if (allocator_ == other.allocator_) {
+      release_storage();
+      take_storage(other);
+    } else {
+      release_storage();
+      create_storage(other.capacity_);
+      for (size_type pos = other.head_; pos != other.tail_; ++pos) {
+        emplace_back(std::move(other.slot(pos)));
+      }
+      other.clear();
+    }
+    return *this;
+  }
+
+  allocator_type get_allocator() const { return allocator_; }
+
+  reference front() { return slot(head_); }
+  const_reference front() const { return slot(head_); }
+  reference back() { return slot(tail_ - 1); }
+  const_reference back() const { return slot(tail_ - 1); }
+
+  // Elements counted from front().
+  reference operator[](size_type pos) { return slot(head_ + pos); }
+  const_reference operator[](size_type pos) const { return slot(head_ + pos); }
+  reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("ring_buffer::at: index out of range");
+    }
+    return (*this)[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("ring_buffer::at: index out of range");
+    }
+    return (*this)[pos];
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return head_ == tail_; }
+  [[nodiscard]] bool full() const noexcept { return size() == capacity_; }
+  [[nodiscard]] size_type size() const noexcept { return tail_ - head_; }
+  [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+  [[nodiscard]] size_type max_size() const noexcept { return alloc_traits::max_size(allocator_); }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    if (full()) {
+      throw std::length_error("ring_buffer::emplace_back: buffer is full");
+    }
+    alloc_traits::construct(allocator_, std::addressof(slot(tail_)), std::forward<Args>(args)...);
+    return slot(tail_++);
+  }
+
+  void pop_front() noexcept {
+    alloc_traits::destroy(allocator_, std::addressof(slot(head_)));
+    ++head_;
+  }
+
+  void pop_back() noexcept {
+    --tail_;
+    alloc_traits::destroy(allocator_, std::addressof(slot(tail_)));
+  }
+
+  void clear() noexcept {
+    while (!empty()) {
+      pop_front();
+    }
+    head_ = tail_ = 0;
+  }
+
+  void swap(ring_buffer& other) noexcept {
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(allocator_, other.allocator_);
+    }
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+  }
+
+ private:
+  allocator_type allocator_;
+  pointer data_;
+  size_type capacity_;
+  // Free-running counters; the slot of counter c is c & (capacity_ - 1)
+  size_type head_;
+  size_type tail_;
+
+  reference slot(size_type pos) const noexcept { return data_[pos & (capacity_ - 1)]; }
+
+  void create_storage(size_type capacity) {
+    if (capacity != 0) {
+      capacity = std::bit_ceil(capacity);
+      data_ = alloc_traits::allocate(allocator_, capacity);
+      capacity_ = capacity;
+    }
+  }
+
+  void copy_elements(const ring_buffer& other) {
+    for (size_type pos = other.head_; pos != other.tail_; ++pos) {
+      emplace_back(other.slot(pos));
+    }
+  }
+
+  // Takes other's storage, leaving it empty; *this must own none.
+  void take_storage(ring_buffer& other) noexcept {
+    data_ = std::exchange(other.data_, pointer());
+    capacity_ = std::exchange(other.capacity_, 0);
+    head_ = std::exchange(other.head_, 0);
+    tail_ = std::exchange(other.tail_, 0);
+  }
+
+  void release_storage() noexcept {
+    clear();
+    if (data_) {
+      alloc_traits::deallocate(allocator_, data_, capacity_);
+    }
+    data_ = pointer();
+    capacity_ = 0;
+  }
+};
+} // namespace s21
+
+#endif // S21_RING_BUFFER_H_
@@ -0,0 +1,15 @@
+#ifndef S21_SMALL_VECTOR_H_
+#define S21_SMALL_VECTOR_H_
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// A vector that keeps up to N elements inside the object itself and only
+// allocates through Allocator once it grows past them. It shares the whole
+// implementation, API and iterator types of s21::vector.
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = growth::factor_2>
+using small_vector = vector<T, Allocator, GrowthPolicy, N>;
+} // namespace s21
+
+#endif // S21_SMALL_VECTOR_H_
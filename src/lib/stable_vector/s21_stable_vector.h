@@ -0,0 +1,16 @@
+#ifndef S21_STABLE_VECTOR_H_
+#define S21_STABLE_VECTOR_H_
+
+#include "../allocator/s21_address_space_allocator.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// A vector whose storage is a fixed address space reservation that commits
+// pages as it grows. Elements are never moved by growth, so pointers,
+// references and iterators stay valid until the elements are erased. The
+// reservation size is taken from the allocator passed to the constructor.
+template <typename T, typename GrowthPolicy = growth::page_rounded<>>
+using stable_vector = vector<T, address_space_allocator<T>, GrowthPolicy>;
+} // namespace s21
+
+#endif // S21_STABLE_VECTOR_H_
@@ -1,10 +1,10 @@
 #ifndef S21_STACK_H_
 #define S21_STACK_H_
 
-#include <deque>
+#include "../deque/s21_deque.h"
 
 namespace s21 {
-template <typename T, typename Container = std::deque<T>>
+template <typename T, typename Container = s21::deque<T>>
 class stack {
   using value_type = T;
   using reference = T&;
@@ -41,10 +41,10 @@ class stack {
   }
 
   reference top() {
-    return container_.top();
+    return container_.back();
   }
   const_reference top() const {
-    return container_.top();
+    return container_.back();
   }
 
   [[nodiscard]] bool empty() const {
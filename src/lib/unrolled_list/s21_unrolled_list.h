@@ -0,0 +1,530 @@
+#ifndef S21_UNROLLED_LIST_H_
+#define S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../list/s21_list.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// Elements per block when none is given: about four cache lines.
+template <typename T>
+inline constexpr std::size_t unrolled_list_block_size = std::max<std::size_t>(4, 256 / sizeof(T));
+
+// A doubly linked list of blocks holding up to K elements each, packed at
+// the front of the block. Scans touch one node per K elements, and
+// inserting or erasing in the middle moves at most K elements. A full
+// block is split in half on insertion; a block that drops below half full
+// on erasure absorbs its successor when both fit in one block.
+//
+// Unlike s21::list, elements move between slots: insert and erase
+// invalidate iterators into the blocks they touch, and splice and merge
+// move element values rather than nodes, except when a whole list is
+// spliced.
+template <typename T, std::size_t K = unrolled_list_block_size<T>,
+          typename Allocator = std::allocator<T>>
+class unrolled_list {
+  static_assert(K >= 2, "unrolled_list blocks must hold at least two elements");
+
+  using node_base = list_details::list_node_base;
+
+  struct block : node_base {
+    // Leaves storage uninitialized
+    block() noexcept {}
+
+    std::size_t count = 0;
+    alignas(T) unsigned char storage[K * sizeof(T)];
+
+    T* at(std::size_t index) noexcept { return std::launder(reinterpret_cast<T*>(storage)) + index; }
+  };
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using block_allocator = typename alloc_traits::template rebind_alloc<block>;
+  using block_traits = std::allocator_traits<block_allocator>;
+
+  static block* as_block(const node_base* node) noexcept {
+    return static_cast<block*>(const_cast<node_base*>(node));
+  }
+
+ public:
+  template <bool Const>
+  struct unrolled_iterator {
+    using Self = unrolled_iterator;
+
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using pointer = std::conditional_t<Const, const T*, T*>;
+    using reference = std::conditional_t<Const, const T&, T&>;
+
+    unrolled_iterator() noexcept : node_(nullptr), index_(0) {}
+    template <bool OtherConst>
+      requires (Const && !OtherConst)
+    unrolled_iterator(const unrolled_iterator<OtherConst>& other) noexcept
+      : node_(other.node_), index_(other.index_) {}
+
+    reference operator*() const noexcept { return *as_block(node_)->at(index_); }
+    pointer operator->() const noexcept { return as_block(node_)->at(index_); }
+
+    bool operator==(const Self& rhs) const noexcept = default;
+
+    Self& operator++() noexcept {
+      if (++index_ == as_block(node_)->count) {
+        node_ = node_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+    Self operator++(int) noexcept {
+      Self tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    Self& operator--() noexcept {
+      if (index_ == 0) {
+        node_ = node_->prev;
+        index_ = as_block(node_)->count;
+      }
+      --index_;
+      return *this;
+    }
+    Self operator--(int) noexcept {
+      Self tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+   private:
+    unrolled_iterator(const node_base* node, std::size_t index) noexcept
+      : node_(const_cast<node_base*>(node)), index_(index) {}
+
+    // end() is the sentinel with index 0; any other iterator has index_
+    // below its block's count.
+    node_base* node_;
+    std::size_t index_;
+    friend class unrolled_list;
+    friend struct unrolled_iterator<true>;
+  };
+
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = unrolled_iterator<false>;
+  using const_iterator = unrolled_iterator<true>;
+
+  static constexpr size_type k_block_size = K;
+
+  unrolled_list() noexcept(noexcept(allocator_type())) : unrolled_list(allocator_type()) {}
+  explicit unrolled_list(const allocator_type& alloc) noexcept : allocator_(alloc) {}
+  // The delegating constructors below count as constructed once the
+  // target returns, so the destructor cleans up if they throw.
+  explicit unrolled_list(size_type count, const_reference value = value_type(),
+                         const allocator_type& alloc = allocator_type())
+    : unrolled_list(alloc) {
+    for (size_type i = 0; i < count; ++i) {
+      push_back(value);
+    }
+  }
+  template <std::input_iterator It>
+  unrolled_list(It first, It last, const allocator_type& alloc = allocator_type())
+    : unrolled_list(alloc) {
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  }
+  unrolled_list(std::initializer_list<value_type> items, const allocator_type& alloc = allocator_type())
+    : unrolled_list(items.begin(), items.end(), alloc) {}
+  unrolled_list(const unrolled_list& other)
+    : unrolled_list(other.begin(), other.end(),
+                    alloc_traits::select_on_container_copy_construction(other.get_allocator())) {}
+  unrolled_list(unrolled_list&& other) noexcept : allocator_(other.allocator_) {
+    splice(cend(), other);
+  }
+  ~unrolled_list() { clear(); }
+
+  unrolled_list& operator=(const unrolled_list& other) {
+    if (this != &other) {
+      unrolled_list tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  unrolled_list& operator=(unrolled_list&& other) {
+    if (this == &other) {
+      return *this;
+    }
+    clear();
+    if constexpr (block_traits::propagate_on_container_move_assignment::value) {
+      allocator_ = other.allocator_;
+    }
+    if (allocator_ == other.allocator_) {
+      splice(cend(), other);
+    } else {
+      for (auto& value : other) {
+        emplace_back(std::move(value));
+      }
+      other.clear();
+    }
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return allocator_type(allocator_); }
+
+  reference front() noexcept { return *begin(); }
+  const_reference front() const noexcept { return *begin(); }
+  reference back() noexcept { return *--end(); }
+  const_reference back() const noexcept { return *--end(); }
+
+  iterator begin() noexcept { return iterator(sentinel_.next, 0); }
+  iterator end() noexcept { return iterator(&sentinel_, 0); }
+  const_iterator begin() const noexcept { return const_iterator(sentinel_.next, 0); }
+  const_iterator end() const noexcept { return const_iterator(&sentinel_, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::min(block_traits::max_size(allocator_),
+                    std::numeric_limits<size_type>::max() / K) * K;
+  }
+
+  void clear() noexcept { erase_to_end(cbegin()); }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    auto [target, index] = open_slot(pos.node_, pos.index_);
+    try {
+      if (index == target->count) {
+        std::construct_at(target->at(index), std::forward<Args>(args)...);
+      } else {
+        // Built first, so a throwing constructor leaves the block intact
+        T value(std::forward<Args>(args)...);
+        T* data = target->at(0);
+        std::construct_at(data + target->count, std::move(data[target->count - 1]));
+        ++target->count;
+        std::move_backward(data + index, data + target->count - 2, data + target->count - 1);
+        data[index] = std::move(value);
+        ++size_;
+        return iterator(target, index);
+      }
+    } catch (...) {
+      if (target->count == 0) {
+        release_block(target);
+      }
+      throw;
+    }
+    ++target->count;
+    ++size_;
+    return iterator(target, index);
+  }
+  iterator insert(const_iterator pos, const_reference value) { return emplace(pos, value); }
+  iterator insert(const_iterator pos, value_type&& value) { return emplace(pos, std::move(value)); }
+
+  // Inserts every argument before pos, in order; returns the last one
+  // inserted.
+  template <typename... Args> requires (std::constructible_from<value_type, Args&&> && ...)
+  iterator insert_many(const_iterator pos, Args&&... args) {
+    iterator result(pos.node_, pos.index_);
+    ((result = emplace(pos, std::forward<Args>(args)), pos = std::next(result)), ...);
+    return result;
+  }
+
+  iterator erase(const_iterator pos) {
+    block* target = as_block(pos.node_);
+    T* data = target->at(0);
+    std::move(data + pos.index_ + 1, data + target->count, data + pos.index_);
+    std::destroy_at(data + target->count - 1);
+    --target->count;
+    --size_;
+    return rebalance(target, pos.index_);
+  }
+  iterator erase(const_iterator first, const_iterator last) {
+    auto count = std::distance(first, last);
+    iterator iter(first.node_, first.index_);
+    for (; count != 0; --count) {
+      iter = erase(iter);
+    }
+    return iter;
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    return *emplace(cend(), std::forward<Args>(args)...);
+  }
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type&& value) { emplace_back(std::move(value)); }
+  void pop_back() noexcept {
+    block* last = as_block(sentinel_.prev);
+    std::destroy_at(last->at(--last->count));
+    --size_;
+    if (last->count == 0) {
+      release_block(last);
+    }
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    return *emplace(cbegin(), std::forward<Args>(args)...);
+  }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type&& value) { emplace_front(std::move(value)); }
+  void pop_front() { erase(cbegin()); }
+
+  void swap(unrolled_list& other) noexcept {
+    if (this == &other) {
+      return;
+    }
+    node_base::swap_sentinels(sentinel_, other.sentinel_);
+    std::swap(size_, other.size_);
+    if constexpr (block_traits::propagate_on_container_swap::value) {
+      std::swap(allocator_, other.allocator_);
+    }
+  }
+
+  // Merges the sorted other into this sorted list; equal elements of this
+  // list come first. Values are moved into new blocks. If comp or a move
+  // throws, no element is lost: the values merged so far are put back at
+  // the front of this list, in unspecified order with the rest.
+  template <typename Compare>
+  void merge(unrolled_list& other, Compare comp) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    unrolled_list merged(allocator_);
+    auto lhs = begin();
+    auto rhs = other.begin();
+    try {
+      while (lhs != end() && rhs != other.end()) {
+        auto& source = comp(*rhs, *lhs) ? rhs : lhs;
+        merged.emplace_back(std::move(*source));
+        ++source;
+      }
+      for (; lhs != end(); ++lhs) {
+        merged.emplace_back(std::move(*lhs));
+      }
+      for (; rhs != other.end(); ++rhs) {
+        merged.emplace_back(std::move(*rhs));
+      }
+    } catch (...) {
+      // Only the moved-from values before lhs and rhs are dropped
+      erase(cbegin(), lhs);
+      other.erase(other.cbegin(), rhs);
+      splice(cbegin(), merged);
+      throw;
+    }
+    clear();
+    other.clear();
+    splice(cend(), merged);
+  }
+  void merge(unrolled_list& other) { merge(other, std::less<>()); }
+
+  // A whole list moves its blocks in O(K), splitting the block at pos.
+  // Elements of a range are moved one by one.
+  void splice(const_iterator pos, unrolled_list& other) {
+    if (this == &other || other.empty()) {
+      return;
+    }
+    node_base* before = split_at(pos);
+    node_base* first = other.sentinel_.next;
+    node_base* last = other.sentinel_.prev;
+    node_base::unlink_group(first, last);
+    before->link_group_before(first, last);
+    size_ += std::exchange(other.size_, 0);
+  }
+  void splice(const_iterator pos, unrolled_list& other, const_iterator iter) {
+    splice(pos, other, iter, std::next(iter));
+  }
+  void splice(const_iterator pos, unrolled_list& other, const_iterator first, const_iterator last) {
+    if (first == last) {
+      return;
+    }
+    bool same = this == &other;
+    // Erasing from this list moves pos, so it is found again by ordinal
+    auto ordinal = same ? std::distance(cbegin(), pos) : 0;
+    if (same && std::distance(cbegin(), first) < ordinal) {
+      ordinal -= std::distance(first, last);
+    }
+    unrolled_list moved(allocator_);
+    for (auto iter = first; iter != last; ++iter) {
+      moved.emplace_back(std::move(*as_block(iter.node_)->at(iter.index_)));
+    }
+    other.erase(first, last);
+    splice(same ? std::next(cbegin(), ordinal) : pos, moved);
+  }
+
+  void reverse() noexcept {
+    node_base* node = &sentinel_;
+    do {
+      if (node != &sentinel_) {
+        std::reverse(as_block(node)->at(0), as_block(node)->at(as_block(node)->count));
+      }
+      node->reverse();
+      node = node->prev;
+    } while (node != &sentinel_);
+  }
+
+  template <typename BinaryPredicate>
+  void unique(BinaryPredicate equal) {
+    if (size_ < 2) {
+      return;
+    }
+    iterator write = begin();
+    for (iterator read = std::next(write); read != end(); ++read) {
+      if (!equal(*write, *read) && ++write != read) {
+        *write = std::move(*read);
+      }
+    }
+    erase_to_end(++write);
+  }
+  void unique() { unique(std::equal_to<>()); }
+
+  // Stable. The values are moved through a temporary buffer, from the
+  // list's allocator, and back into the same slots.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) {
+      return;
+    }
+    using buffer_allocator = typename alloc_traits::template rebind_alloc<T>;
+    s21::vector<T, buffer_allocator> buffer{buffer_allocator(allocator_)};
+    buffer.reserve(size_);
+    for (auto& value : *this) {
+      buffer.push_back(std::move(value));
+    }
+    std::stable_sort(buffer.data(), buffer.data() + buffer.size(), comp);
+    std::move(buffer.data(), buffer.data() + buffer.size(), begin());
+  }
+  void sort() { sort(std::less<>()); }
+
+ private:
+  block* allocate_block(node_base* before) {
+    block* created = std::to_address(block_traits::allocate(allocator_, 1));
+    std::construct_at(created);
+    created->link_before(before);
+    return created;
+  }
+
+  void release_block(block* target) noexcept {
+    target->unlink();
+    std::destroy_at(target);
+    block_traits::deallocate(allocator_, target, 1);
+  }
+
+  // Moves the last count elements of from to the end of to.
+  static void relocate(block* from, std::size_t count, block* to) {
+    T* first = from->at(from->count - count);
+    std::uninitialized_move(first, first + count, to->at(to->count));
+    std::destroy(first, first + count);
+    from->count -= count;
+    to->count += count;
+  }
+
+  // The block and index where an element inserted before (node, index)
+  // goes, with a free slot: the end of the previous block when inserting
+  // at the front of a block, else the same place after splitting a full
+  // block in half.
+  std::pair<block*, std::size_t> open_slot(node_base* node, std::size_t index) {
+    if (index == 0 && node->prev != &sentinel_ && as_block(node->prev)->count < K) {
+      block* prev = as_block(node->prev);
+      return {prev, prev->count};
+    }
+    if (node == &sentinel_) {
+      return {allocate_block(&sentinel_), 0};
+    }
+    block* target = as_block(node);
+    if (target->count == K) {
+      block* upper = allocate_block(target->next);
+      try {
+        relocate(target, K - K / 2, upper);
+      } catch (...) {
+        release_block(upper);
+        throw;
+      }
+      if (index > K / 2) {
+        return {upper, index - K / 2};
+      }
+    }
+    return {target, index};
+  }
+
+  // The node to link a chain before so that it lands at pos: pos's own
+  // block, or the upper part split off it.
+  node_base* split_at(const_iterator pos) {
+    if (pos.index_ == 0) {
+      return pos.node_;
+    }
+    block* target = as_block(pos.node_);
+    block* upper = allocate_block(target->next);
+    try {
+      relocate(target, target->count - pos.index_, upper);
+    } catch (...) {
+      release_block(upper);
+      throw;
+    }
+    return upper;
+  }
+
+  // Called after an element at index was removed from target: frees the
+  // block once empty, or absorbs the next block when both fit in one.
+  iterator rebalance(block* target, std::size_t index) noexcept {
+    if (target->count == 0) {
+      node_base* next = target->next;
+      release_block(target);
+      return iterator(next, 0);
+    }
+    if constexpr (std::is_nothrow_move_constructible_v<T>) {
+      node_base* next = target->next;
+      if (target->count < K / 2 && next != &sentinel_
+          && target->count + as_block(next)->count <= K) {
+        relocate(as_block(next), as_block(next)->count, target);
+        release_block(as_block(next));
+      }
+    }
+    if (index == target->count) {
+      return iterator(target->next, 0);
+    }
+    return iterator(target, index);
+  }
+
+  void erase_to_end(const_iterator from) noexcept {
+    if (from == cend()) {
+      return;
+    }
+    block* target = as_block(from.node_);
+    node_base* next = target->next;
+    std::destroy(target->at(from.index_), target->at(target->count));
+    size_ -= target->count - from.index_;
+    target->count = from.index_;
+    if (target->count == 0) {
+      release_block(target);
+    }
+    while (next != &sentinel_) {
+      target = as_block(next);
+      next = next->next;
+      std::destroy(target->at(0), target->at(target->count));
+      size_ -= target->count;
+      release_block(target);
+    }
+  }
+
+  node_base sentinel_;
+  size_type size_ = 0;
+  [[no_unique_address]] block_allocator allocator_;
+};
+} // namespace s21
+
+#endif // S21_UNROLLED_LIST_H_
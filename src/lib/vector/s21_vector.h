@@ -1,15 +1,109 @@
 #ifndef S21_VECTOR_H_
 #define S21_VECTOR_H_
 
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <type_traits>
 
 namespace s21 {
-template <typename T, typename Allocator>
+// A type is trivially relocatable when moving an object and destroying the
+// source is equivalent to copying its bytes. Trivially copyable types are
+// detected automatically; other types may opt in by specializing this trait.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// Growth policies decide the capacity of the next allocation when a vector
+// runs out of storage. next_capacity receives the current capacity and the
+// element size in bytes; the vector never allocates less than it needs.
+namespace growth {
+struct factor_2 {
+  static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t) noexcept {
+    return capacity == 0 ? 1 : capacity * 2;
+  }
+};
+
+struct factor_1_5 {
+  static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t) noexcept {
+    return capacity < 2 ? capacity + 1 : capacity + capacity / 2;
+  }
+};
+
+// Rounds the capacity chosen by Policy up to a whole number of pages.
+template <typename Policy = factor_2, std::size_t PageSize = 4096>
+struct page_rounded {
+  static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t value_size) noexcept {
+    std::size_t bytes = Policy::next_capacity(capacity, value_size) * value_size;
+    bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+    return bytes / value_size;
+  }
+};
+
+// Doubles until the storage reaches Threshold bytes, then grows by Step bytes.
+template <std::size_t Threshold = (std::size_t(64) << 20), std::size_t Step = Threshold>
+struct capped_linear {
+  static constexpr std::size_t next_capacity(std::size_t capacity, std::size_t value_size) noexcept {
+    if (capacity * value_size < Threshold) {
+      return factor_2::next_capacity(capacity, value_size);
+    }
+    return capacity + std::max<std::size_t>(1, Step / value_size);
+  }
+};
+} // namespace growth
+
+// Tag selecting default-initialization: trivial types are left
+// uninitialized instead of being zero-filled.
+struct default_init_t {
+  explicit default_init_t() = default;
+};
+inline constexpr default_init_t default_init{};
+
+// Raw storage for the first N elements of a small_vector.
+template <typename T, std::size_t N>
+struct vector_inline_storage {
+  alignas(T) unsigned char buffer[N * sizeof(T)];
+
+  T* get() noexcept { return reinterpret_cast<T*>(buffer); }
+  const T* get() const noexcept { return reinterpret_cast<const T*>(buffer); }
+};
+
+template <typename T>
+struct vector_inline_storage<T, 0> {
+  T* get() const noexcept { return nullptr; }
+};
+
+template <typename T, typename Allocator, typename GrowthPolicy = growth::factor_2,
+          std::size_t InlineCapacity = 0>
 struct vector_base {
   using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
   using pointer = typename std::allocator_traits<allocator_type>::pointer;
 
+  static_assert(InlineCapacity == 0 || std::is_same_v<pointer, T*>,
+    "inline storage requires an allocator with raw pointers");
+
+  static constexpr std::size_t k_inline_capacity = InlineCapacity;
+  // Allocators may provide reallocate_in_place(ptr, old_count, new_count)
+  // to resize a block without moving it (see s21::address_space_allocator).
+  static constexpr bool k_in_place_resize =
+    requires(allocator_type& alloc, pointer ptr, size_t count) {
+      { alloc.reallocate_in_place(ptr, count, count) } -> std::convertible_to<bool>;
+    };
+
+  static constexpr bool k_relocatable = is_trivially_relocatable_v<T>;
+  // With the default allocator relocatable elements live in malloc'ed storage,
+  // so growth can go through realloc (which uses mremap for large blocks).
+  static constexpr bool k_heap_realloc = k_relocatable &&
+    std::is_same_v<allocator_type, std::allocator<T>> &&
+    alignof(T) <= alignof(std::max_align_t);
+
   struct vector_data {
     pointer start;
     pointer finish;
@@ -36,42 +130,130 @@ struct vector_base {
   };
 
   // vector_base() = default;
-  explicit vector_base(const allocator_type& alloc = allocator_type()) : allocator_(alloc), data_() {}
+  explicit vector_base(const allocator_type& alloc = allocator_type()) : allocator_(alloc), data_() { reset_storage(); }
   explicit vector_base(size_t size, const allocator_type& alloc = allocator_type()) : allocator_(alloc), data_() { create_storage(size); }
-  vector_base(vector_base&& other) = default;
+  vector_base(vector_base&& other) noexcept(InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>)
+    : allocator_(std::move(other.allocator_)), data_() {
+    reset_storage();
+    take_storage(other);
+  }
   ~vector_base() { deallocate(data_.start, data_.end_of_storage - data_.start); }
 
  protected:
   allocator_type allocator_;
   vector_data data_;
+  [[no_unique_address]] vector_inline_storage<T, InlineCapacity> inline_;
+
+  bool is_inline(pointer ptr) const noexcept {
+    if constexpr (InlineCapacity == 0) {
+      return false;
+    } else {
+      return ptr == inline_.get();
+    }
+  }
+
+  // Points data_ at the inline buffer, or at nothing when there is none.
+  void reset_storage() noexcept {
+    data_.start = data_.finish = inline_.get();
+    data_.end_of_storage = data_.start + InlineCapacity;
+  }
 
-  pointer allocate(size_t size) noexcept {
+  // Takes other's elements, leaving it empty. Heap storage is stolen; inline
+  // elements are moved one by one. *this must hold reset, empty storage.
+  void take_storage(vector_base& other) {
+    if (other.is_inline(other.data_.start)) {
+      data_.finish = std::uninitialized_move(other.data_.start, other.data_.finish, data_.start);
+      std::destroy(other.data_.start, other.data_.finish);
+      other.data_.finish = other.data_.start;
+    } else {
+      data_.copy(other.data_);
+      other.reset_storage();
+    }
+  }
+
+  pointer allocate(size_t size) {
     // static int count = 0;
     // std::cout << "Allocated: " << count++ << " " << size << std::endl;
-    return size != 0 ? std::allocator_traits<allocator_type>::
-      allocate(allocator_, size) : pointer();
+    if constexpr (k_heap_realloc) {
+      return size != 0 ? heap_realloc(pointer(), size) : pointer();
+    } else {
+      return size != 0 ? std::allocator_traits<allocator_type>::
+        allocate(allocator_, size) : pointer();
+    }
   }
 
   void deallocate(pointer ptr, size_t size) noexcept {
-    if (ptr) {
-      std::allocator_traits<allocator_type>::
-        deallocate(allocator_, ptr, size);
+    if (ptr && !is_inline(ptr)) {
+      if constexpr (k_heap_realloc) {
+        std::free(ptr);
+      } else {
+        std::allocator_traits<allocator_type>::
+          deallocate(allocator_, ptr, size);
+      }
+    }
+  }
+
+  static pointer heap_realloc(pointer ptr, size_t size) {
+    if (size > std::size_t(-1) / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    auto new_ptr = static_cast<pointer>(std::realloc(static_cast<void*>(ptr), size * sizeof(T)));
+    if (!new_ptr) {
+      throw std::bad_alloc();
+    }
+    return new_ptr;
+  }
+
+  // Moves [first, last) to dest bitwise; ranges may overlap.
+  static void relocate(pointer first, pointer last, pointer dest) noexcept {
+    if (first != last) {
+      std::memmove(static_cast<void*>(dest), static_cast<const void*>(first),
+        static_cast<size_t>(last - first) * sizeof(T));
     }
   }
 
   allocator_type get_allocator() const { return allocator_; }
 
-  void create_storage(size_t size) noexcept {
+  // Resizes the current heap block to new_capacity without moving the
+  // elements; false when the allocator cannot.
+  bool resize_in_place(size_t new_capacity) {
+    if constexpr (k_in_place_resize) {
+      auto capacity = static_cast<size_t>(data_.end_of_storage - data_.start);
+      if (data_.start && !is_inline(data_.start) &&
+          allocator_.reallocate_in_place(data_.start, capacity, new_capacity)) {
+        data_.end_of_storage = data_.start + new_capacity;
+        return true;
+      }
+    }
+    (void)new_capacity;
+    return false;
+  }
+
+  // Capacity to allocate when at least required elements must fit. Growth
+  // stops at the allocator's max_size(), so only a required count above it
+  // makes the allocation fail.
+  size_t recommend(size_t required) const noexcept {
+    auto capacity = static_cast<size_t>(data_.end_of_storage - data_.start);
+    size_t limit = std::allocator_traits<allocator_type>::max_size(allocator_);
+    return std::max(required, std::min(GrowthPolicy::next_capacity(capacity, sizeof(T)), limit));
+  }
+
+  void create_storage(size_t size) {
+    if (size <= InlineCapacity) {
+      reset_storage();
+      return;
+    }
     data_.start = allocate(size);
     data_.finish = data_.start;
     data_.end_of_storage = data_.start + size;
   }
 };
 
-template <typename T, typename Allocator = std::allocator<T>>
-class vector : protected vector_base<T, Allocator> {
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = growth::factor_2, std::size_t InlineCapacity = 0>
+class vector : protected vector_base<T, Allocator, GrowthPolicy, InlineCapacity> {
  private:
-  using Base = vector_base<T, Allocator>;
+  using Base = vector_base<T, Allocator, GrowthPolicy, InlineCapacity>;
 
  public:
   struct vector_iterator {
@@ -84,7 +266,7 @@ class vector : protected vector_base<T, Allocator> {
     using reference = T&;
 
     vector_iterator() noexcept : ptr_(nullptr) {}
-    vector_iterator(Self& other) noexcept : ptr_(other.ptr_) {}
+    vector_iterator(const Self& other) noexcept : ptr_(other.ptr_) {}
     explicit vector_iterator(pointer ptr) noexcept : ptr_(ptr) {}
 
     Self& operator=(const Self& other) noexcept { ptr_ = other.ptr_; return *this; }
@@ -118,7 +300,7 @@ class vector : protected vector_base<T, Allocator> {
     difference_type operator-(const Self& rhs) const noexcept { return this->ptr_ - rhs.ptr_; }
     friend Self operator+(difference_type n, const Self& iter) { return iter + n; }
     
-    Self operator+(difference_type diff) noexcept {
+    Self operator+(difference_type diff) const noexcept {
       Self tmp = *this;
       tmp += diff;
       return tmp;
@@ -128,7 +310,7 @@ class vector : protected vector_base<T, Allocator> {
       return *this;
     }
 
-    Self operator-(difference_type diff) noexcept {
+    Self operator-(difference_type diff) const noexcept {
       Self tmp = *this;
       tmp -= diff;
       return tmp;
@@ -138,11 +320,11 @@ class vector : protected vector_base<T, Allocator> {
       return *this;
     }
 
-    reference operator[](difference_type diff) noexcept { return ptr_[diff]; }
+    reference operator[](difference_type diff) const noexcept { return ptr_[diff]; }
 
    private:
     pointer ptr_;
-    friend class vector<T, Allocator>;
+    friend class vector<T, Allocator, GrowthPolicy, InlineCapacity>;
   };
 
   struct vector_const_iterator {
@@ -155,7 +337,8 @@ class vector : protected vector_base<T, Allocator> {
     using reference = const T&;
 
     vector_const_iterator() noexcept : k_ptr_(nullptr) {}
-    vector_const_iterator(Self& other) noexcept : k_ptr_(other.k_ptr_) {}
+    vector_const_iterator(const Self& other) noexcept : k_ptr_(other.k_ptr_) {}
+    vector_const_iterator(const vector_iterator& other) noexcept : k_ptr_(other.operator->()) {}
     explicit vector_const_iterator(pointer ptr) noexcept : k_ptr_(ptr) {}
 
     reference operator*() const noexcept { return *k_ptr_; }
@@ -183,10 +366,10 @@ class vector : protected vector_base<T, Allocator> {
       return tmp;
     }
 
-    difference_type operator-(const Self& rhs) const noexcept { return this->ptr_ - rhs.ptr_; }
+    difference_type operator-(const Self& rhs) const noexcept { return this->k_ptr_ - rhs.k_ptr_; }
     friend Self operator+(difference_type n, const Self& iter) { return iter + n; }
     
-    Self operator+(difference_type diff) noexcept {
+    Self operator+(difference_type diff) const noexcept {
       Self tmp = *this;
       tmp += diff;
       return tmp;
@@ -196,7 +379,7 @@ class vector : protected vector_base<T, Allocator> {
       return *this;
     }
 
-    Self operator-(difference_type diff) noexcept {
+    Self operator-(difference_type diff) const noexcept {
       Self tmp = *this;
       tmp -= diff;
       return tmp;
@@ -206,15 +389,16 @@ class vector : protected vector_base<T, Allocator> {
       return *this;
     }
 
-    reference operator[](difference_type diff) noexcept { return k_ptr_[diff]; }
+    reference operator[](difference_type diff) const noexcept { return k_ptr_[diff]; }
 
    private:
     pointer k_ptr_;
-    friend class vector<T, Allocator>;
+    friend class vector<T, Allocator, GrowthPolicy, InlineCapacity>;
   };
 
   using value_type = T;
   using allocator_type = Allocator;
+  using growth_policy = GrowthPolicy;
   using size_type = std::size_t;
   using difference_type = ptrdiff_t;
   using reference = T&;
@@ -226,6 +410,8 @@ class vector : protected vector_base<T, Allocator> {
   using iterator = vector_iterator;
   using const_iterator = vector_const_iterator;
 
+  using Base::get_allocator;
+
   vector() noexcept(noexcept(allocator_type())) : vector(allocator_type()) {}
 
   explicit constexpr vector(const allocator_type& alloc) noexcept : Base(alloc) {}
@@ -237,36 +423,45 @@ class vector : protected vector_base<T, Allocator> {
     this->data_.finish = this->data_.start + count;
   }
 
+  vector(size_type count, default_init_t, const allocator_type& alloc = allocator_type())
+    : Base(count, alloc) {
+    std::uninitialized_default_construct(this->data_.start, this->data_.start + count);
+    this->data_.finish = this->data_.start + count;
+  }
+
   constexpr vector(size_type count, const_reference value,
     const allocator_type& alloc = allocator_type()) : Base(count, alloc) {
-    std::uninitialized_fill_n(this->data_.start, count, value);
-    this->data_.finish = this->data_.end_of_storage;
+    this->data_.finish = std::uninitialized_fill_n(this->data_.start, count, value);
   }
 
   vector(std::initializer_list<value_type> const &items,
     const Allocator& alloc = Allocator()) : Base(items.size(), alloc) {
-    std::uninitialized_copy(items.begin(), items.end(), this->data_.start);
-    this->data_.finish = this->data_.end_of_storage;
+    this->data_.finish = std::uninitialized_copy(items.begin(), items.end(), this->data_.start);
+  }
+
+  template <std::input_iterator InputIt>
+  vector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+    : Base(alloc) {
+    assign(first, last);
   }
 
   constexpr vector(const vector& other) : vector(other, other.allocator_) {}
 
   constexpr vector(const vector& other, const Allocator& alloc)
     : Base(other.size(), alloc) {
-    std::uninitialized_copy(other.data_.start, other.data_.finish, this->data_.start);
-    this->data_.finish = this->data_.end_of_storage;
+    this->data_.finish = std::uninitialized_copy(other.data_.start, other.data_.finish, this->data_.start);
   }
 
-  constexpr vector(vector&& other) noexcept : Base(std::move(other)) {}
+  constexpr vector(vector&& other) noexcept(std::is_nothrow_constructible_v<Base, Base&&>)
+    : Base(std::move(other)) {}
 
   vector(vector&& other, const Allocator& alloc) : Base(alloc) {
     if (std::allocator_traits<allocator_type>::is_always_equal::value ||
       alloc == other.get_allocator()) {
-      this->data_ = std::move(other.data_);
+      this->take_storage(other);
     } else {
       this->create_storage(other.size());
-      std::uninitialized_move(other.data_.start, other.data_.finish, this->data_.start);
-      this->data_.finish = this->data_.end_of_storage;
+      this->data_.finish = std::uninitialized_move(other.data_.start, other.data_.finish, this->data_.start);
     }
   }
 
@@ -275,28 +470,70 @@ class vector : protected vector_base<T, Allocator> {
   }
 
   vector& operator=(vector&& other)
-    noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value
-    || std::allocator_traits<Allocator>::is_always_equal::value) {
+    noexcept((std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value
+    || std::allocator_traits<Allocator>::is_always_equal::value)
+    && (InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>)) {
     if (this == &other) {
       return *this;
     }
-    std::destroy(this->data_.start, this->data_.finish);
+    clear();
     if constexpr (std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value
     || std::allocator_traits<Allocator>::is_always_equal::value) {
       this->deallocate(this->data_.start, this->data_.end_of_storage - this->data_.start);
+      this->reset_storage();
       this->allocator_ = std::move(other.allocator_);
-      this->data_.copy(other.data_);
+      this->take_storage(other);
     } else if (this->allocator_ == other.allocator_) {
       this->deallocate(this->data_.start, this->data_.end_of_storage - this->data_.start);
-      this->data_.copy(other.data_);
+      this->reset_storage();
+      this->take_storage(other);
     } else {
       this->reserve(other.size());
       this->data_.finish = std::uninitialized_move(other.data_.start, other.data_.finish, this->data_.start);
+      other.clear();
     }
-    other.data_.start = other.data_.finish = other.data_.end_of_storage = pointer();
     return *this;
   }
 
+  void assign(size_type count, const_reference value) {
+    if (count > this->capacity()) {
+      replace_storage(count, [&](pointer dest) {
+        return std::uninitialized_fill_n(dest, count, value);
+      });
+    } else if (count > this->size()) {
+      std::fill(this->data_.start, this->data_.finish, value);
+      this->data_.finish = std::uninitialized_fill_n(this->data_.finish, count - this->size(), value);
+    } else {
+      std::fill_n(this->data_.start, count, value);
+      truncate(this->data_.start + count);
+    }
+  }
+  template <std::input_iterator InputIt>
+  void assign(InputIt first, InputIt last) {
+    if constexpr (std::forward_iterator<InputIt>) {
+      auto count = static_cast<size_type>(std::distance(first, last));
+      if (count > this->capacity()) {
+        replace_storage(count, [&](pointer dest) {
+          return std::uninitialized_copy(first, last, dest);
+        });
+      } else if (count > this->size()) {
+        InputIt mid = std::next(first, static_cast<difference_type>(this->size()));
+        std::copy(first, mid, this->data_.start);
+        this->data_.finish = std::uninitialized_copy(mid, last, this->data_.finish);
+      } else {
+        truncate(std::copy(first, last, this->data_.start));
+      }
+    } else {
+      clear();
+      for (; first != last; ++first) {
+        emplace_back(*first);
+      }
+    }
+  }
+  void assign(std::initializer_list<value_type> items) {
+    assign(items.begin(), items.end());
+  }
+
   constexpr reference at(size_type pos) {
     if (pos >= this->size()) {
       throw std::out_of_range("vector::at: index out of range");
@@ -371,14 +608,42 @@ class vector : protected vector_base<T, Allocator> {
       reallocate(size);
     }
   }
+  constexpr void resize(size_type count) {
+    if (count <= this->size()) {
+      truncate(this->data_.start + count);
+      return;
+    }
+    if (count > this->capacity()) {
+      reallocate(this->recommend(count));
+    }
+    std::uninitialized_value_construct(this->data_.finish, this->data_.start + count);
+    this->data_.finish = this->data_.start + count;
+  }
+  // Like resize, but new elements are left uninitialized, e.g. for a buffer
+  // that read() is about to fill.
+  constexpr void resize_uninitialized(size_type count)
+    requires std::is_trivially_default_constructible_v<T> {
+    if (count > this->capacity()) {
+      reallocate(this->recommend(count));
+    }
+    truncate(this->data_.start + std::min(count, this->size()));
+    this->data_.finish = this->data_.start + count;
+  }
+  constexpr void resize(size_type count, const_reference value) {
+    if (count <= this->size()) {
+      truncate(this->data_.start + count);
+    } else {
+      insert(cend(), count - this->size(), value);
+    }
+  }
   [[nodiscard]] constexpr size_type capacity() const noexcept {
     return static_cast<size_type>(this->data_.end_of_storage - this->data_.start);
   }
   constexpr void shrink_to_fit() {
-    if (this->size() < this->capacity()) {
+    if (this->size() < this->capacity() && !this->is_inline(this->data_.start)) {
       if (this->size() == 0) {
         this->deallocate(this->data_.start, this->data_.end_of_storage - this->data_.start);
-        this->data_.start = this->data_.finish = this->data_.end_of_storage = pointer();
+        this->reset_storage();
       } else {
         size_type size = this->size();
         reallocate(size);
@@ -390,27 +655,56 @@ class vector : protected vector_base<T, Allocator> {
     std::destroy(this->data_.start, this->data_.finish);
     this->data_.finish = this->data_.start;
   }
-  constexpr iterator insert(iterator pos, const_reference value) {
-    auto size = static_cast<size_type>(this->data_.finish - this->data_.start);
-    size_type index = pos.ptr_ - this->data_.start;
-
-    if (size == this->capacity()) {
-      size_type new_capacity = size == 0 ? 1 : size * 2;
-      this->reserve(new_capacity);
-    }
-
-    iterator actual_pos(this->data_.start + index);
-    
-    if (index < size) {
-      std::construct_at(this->data_.finish, std::move(*(this->data_.finish - 1)));
-      std::move_backward(actual_pos.ptr_, this->data_.finish - 1, this->data_.finish);
-      *actual_pos = value;
+  constexpr iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  constexpr iterator insert(const_iterator pos, value_type&& value) {
+    return emplace(pos, std::move(value));
+  }
+  constexpr iterator insert(const_iterator pos, size_type count, const_reference value) {
+    return insert_with(pos, count, [&](pointer dest) {
+      return std::uninitialized_fill_n(dest, count, value);
+    });
+  }
+  template <std::input_iterator InputIt>
+  constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    if constexpr (std::forward_iterator<InputIt>) {
+      auto count = static_cast<size_type>(std::distance(first, last));
+      return insert_with(pos, count, [&](pointer dest) {
+        return std::uninitialized_copy(first, last, dest);
+      });
     } else {
-      std::construct_at(this->data_.finish, value);
+      // Single-pass input has to be buffered to learn its length
+      vector buffer(first, last, this->allocator_);
+      return insert_with(pos, buffer.size(), [&](pointer dest) {
+        return std::uninitialized_move(buffer.data(), buffer.data() + buffer.size(), dest);
+      });
+    }
+  }
+  constexpr iterator insert(const_iterator pos, std::initializer_list<value_type> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+  template <typename... Args>
+  constexpr iterator emplace(const_iterator pos, Args&&... args) {
+    auto index = static_cast<size_type>(pos.k_ptr_ - this->data_.start);
+
+    if (this->data_.finish == this->data_.end_of_storage &&
+        !this->resize_in_place(this->recommend(this->size() + 1))) {
+      realloc_emplace(index, std::forward<Args>(args)...);
+    } else if (this->data_.start + index == this->data_.finish) {
+      std::construct_at(this->data_.finish, std::forward<Args>(args)...);
+      ++this->data_.finish;
+    } else {
+      // args may refer to an element that is about to be shifted
+      value_type tmp(std::forward<Args>(args)...);
+      pointer position = this->data_.start + index;
+      std::construct_at(this->data_.finish, std::move(*(this->data_.finish - 1)));
+      std::move_backward(position, this->data_.finish - 1, this->data_.finish);
+      *position = std::move(tmp);
+      ++this->data_.finish;
     }
 
-    ++this->data_.finish;
-    return actual_pos;
+    return iterator(this->data_.start + index);
   }
   constexpr iterator erase(const_iterator pos) {
     if (pos.k_ptr_ < this->data_.start || pos.k_ptr_ >= this->data_.finish) {
@@ -442,12 +736,40 @@ class vector : protected vector_base<T, Allocator> {
     return iterator(p_first);
   }
   constexpr void push_back(const_reference value) {
-    if (this->size() == this->capacity()) {
-      this->reserve(this->capacity() == 0 ? 1 : this->capacity() * 2);
-    }
-
-    std::construct_at(this->data_.finish, value);
-    ++this->data_.finish;
+    emplace_back(value);
+  }
+  constexpr void push_back(value_type&& value) {
+    emplace_back(std::move(value));
+  }
+  template <typename... Args>
+  constexpr reference emplace_back(Args&&... args) {
+    if (this->data_.finish == this->data_.end_of_storage &&
+        !this->resize_in_place(this->recommend(this->size() + 1))) {
+      realloc_emplace(this->size(), std::forward<Args>(args)...);
+    } else {
+      std::construct_at(this->data_.finish, std::forward<Args>(args)...);
+      ++this->data_.finish;
+    }
+    return *(this->data_.finish - 1);
+  }
+  template <typename... Args>
+    requires (std::constructible_from<value_type, Args&&> && ...)
+  iterator insert_many(const_iterator pos, Args&&... args) {
+    return insert_with(pos, sizeof...(Args), [&](pointer dest) {
+      pointer current = dest;
+      try {
+        ((std::construct_at(current, std::forward<Args>(args)), ++current), ...);
+      } catch (...) {
+        std::destroy(dest, current);
+        throw;
+      }
+      return current;
+    });
+  }
+  template <typename... Args>
+    requires (std::constructible_from<value_type, Args&&> && ...)
+  void insert_many_back(Args&&... args) {
+    insert_many(cend(), std::forward<Args>(args)...);
   }
   constexpr void pop_back() {
     if (this->size() > 0) {
@@ -456,31 +778,191 @@ class vector : protected vector_base<T, Allocator> {
     }
   }
   constexpr void swap(vector& other)
-    noexcept(std::allocator_traits<allocator_type>::propagate_on_container_swap::value
-    || std::allocator_traits<allocator_type>::is_always_equal::value) {
-    if (this != &other) {
+    noexcept((std::allocator_traits<allocator_type>::propagate_on_container_swap::value
+    || std::allocator_traits<allocator_type>::is_always_equal::value)
+    && (InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>)) {
+    if (this == &other) {
+      return;
+    }
+    constexpr bool k_propagate = std::allocator_traits<allocator_type>::propagate_on_container_swap::value;
+    if (this->is_inline(this->data_.start) || other.is_inline(other.data_.start)) {
+      vector tmp(std::move(other));
+      other.take_storage(*this);
+      this->take_storage(tmp);
+      if constexpr (k_propagate) {
+        other.allocator_ = std::move(this->allocator_);
+        this->allocator_ = std::move(tmp.allocator_);
+      }
+    } else {
       this->data_.swap(other.data_);
+      if constexpr (k_propagate) {
+        using std::swap;
+        swap(this->allocator_, other.allocator_);
+      }
     }
   }
 
  private:
+  // Moves the elements into storage for size elements. Sizes that fit the
+  // inline buffer move back into it.
   void reallocate(size_type size) {
-    pointer new_start = this->allocate(size);
+    size_type count = this->size();
+    bool to_inline = InlineCapacity != 0 && size <= InlineCapacity;
+
+    if (!to_inline && this->resize_in_place(size)) {
+      return;
+    }
+
+    if constexpr (Base::k_heap_realloc) {
+      if (!to_inline && !this->is_inline(this->data_.start)) {
+        this->data_.start = Base::heap_realloc(this->data_.start, size);
+        this->data_.finish = this->data_.start + count;
+        this->data_.end_of_storage = this->data_.start + size;
+        return;
+      }
+    }
+
+    pointer new_start = to_inline ? this->inline_.get() : this->allocate(size);
+
+    if constexpr (Base::k_relocatable) {
+      Base::relocate(this->data_.start, this->data_.finish, new_start);
+    } else {
+      try {
+        std::uninitialized_move(this->data_.start, this->data_.finish, new_start);
+      } catch (...) {
+        this->deallocate(new_start, size);
+        throw;
+      }
+
+      std::destroy(this->data_.start, this->data_.finish);
+    }
+
+    this->deallocate(this->data_.start, this->data_.end_of_storage - this->data_.start);
+    this->data_.start = new_start;
+    this->data_.finish = this->data_.start + count;
+    this->data_.end_of_storage = this->data_.start + std::max(size, InlineCapacity);
+  }
+
+  // Builds the new element straight into the grown storage before the old
+  // elements are moved, so args referring into *this stay valid.
+  template <typename... Args>
+  void realloc_emplace(size_type index, Args&&... args) {
+    size_type new_capacity = this->recommend(this->size() + 1);
+
+    if constexpr (Base::k_heap_realloc) {
+      if (!this->is_inline(this->data_.start)) {
+        realloc_emplace_in_place(index, new_capacity, std::forward<Args>(args)...);
+        return;
+      }
+    }
+
+    realloc_insert(index, 1, new_capacity, [&](pointer dest) {
+      std::construct_at(dest, std::forward<Args>(args)...);
+      return dest + 1;
+    });
+  }
+
+  // Moves the elements into new storage of new_capacity, leaving a gap of
+  // count elements at index that fill(dest) constructs. fill runs before the
+  // old elements are touched, so it may read from them.
+  template <typename Fill>
+  void realloc_insert(size_type index, size_type count, size_type new_capacity, Fill fill) {
+    size_type old_size = this->size();
+    pointer position = this->data_.start + index;
+    pointer new_start = this->allocate(new_capacity);
     pointer new_finish = new_start;
 
     try {
-      new_finish = std::uninitialized_move(this->data_.start, this->data_.finish, new_start);
+      fill(new_start + index);
+      if constexpr (Base::k_relocatable) {
+        Base::relocate(this->data_.start, position, new_start);
+        Base::relocate(position, this->data_.finish, new_start + index + count);
+        new_finish = new_start + old_size + count;
+      } else {
+        new_finish = pointer();
+        new_finish = std::uninitialized_move(this->data_.start, position, new_start) + count;
+        new_finish = std::uninitialized_move(position, this->data_.finish, new_finish);
+      }
     } catch (...) {
-      this->deallocate(new_start, size);
+      if (new_finish) {
+        std::destroy(new_start, new_finish);
+      } else {
+        std::destroy(new_start + index, new_start + index + count);
+      }
+      this->deallocate(new_start, new_capacity);
       throw;
     }
 
-    std::destroy(this->data_.start, this->data_.finish);
+    if constexpr (!Base::k_relocatable) {
+      std::destroy(this->data_.start, this->data_.finish);
+    }
     this->deallocate(this->data_.start, this->data_.end_of_storage - this->data_.start);
 
     this->data_.start = new_start;
     this->data_.finish = new_finish;
-    this->data_.end_of_storage = this->data_.start + size;
+    this->data_.end_of_storage = new_start + new_capacity;
+  }
+
+  // Inserts count elements built by fill(dest) before pos with at most one
+  // reallocation. Within capacity the new elements are appended and rotated
+  // into place, so fill may still read the vector's own elements.
+  template <typename Fill>
+  iterator insert_with(const_iterator pos, size_type count, Fill fill) {
+    auto index = static_cast<size_type>(pos.k_ptr_ - this->data_.start);
+
+    if (count > this->capacity() - this->size() &&
+        !this->resize_in_place(this->recommend(this->size() + count))) {
+      realloc_insert(index, count, this->recommend(this->size() + count), fill);
+    } else if (count != 0) {
+      pointer old_finish = this->data_.finish;
+      this->data_.finish = fill(old_finish);
+      std::rotate(this->data_.start + index, old_finish, this->data_.finish);
+    }
+
+    return iterator(this->data_.start + index);
+  }
+
+  // Replaces the contents with count elements built by fill(dest) in freshly
+  // allocated storage of exactly count elements.
+  template <typename Fill>
+  void replace_storage(size_type count, Fill fill) {
+    pointer new_start = this->allocate(count);
+    try {
+      fill(new_start);
+    } catch (...) {
+      this->deallocate(new_start, count);
+      throw;
+    }
+    clear();
+    this->deallocate(this->data_.start, this->data_.end_of_storage - this->data_.start);
+    this->data_.start = new_start;
+    this->data_.finish = this->data_.end_of_storage = new_start + count;
+  }
+
+  void truncate(pointer new_finish) noexcept {
+    std::destroy(new_finish, this->data_.finish);
+    this->data_.finish = new_finish;
+  }
+
+  // Grows heap storage with realloc. realloc frees the old block, so the
+  // value is built before it.
+  template <typename... Args>
+  void realloc_emplace_in_place(size_type index, size_type new_capacity, Args&&... args) {
+    size_type count = this->size();
+    value_type tmp(std::forward<Args>(args)...);
+    this->data_.start = Base::heap_realloc(this->data_.start, new_capacity);
+    this->data_.finish = this->data_.start + count;
+    this->data_.end_of_storage = this->data_.start + new_capacity;
+
+    pointer position = this->data_.start + index;
+    Base::relocate(position, this->data_.finish, position + 1);
+    try {
+      std::construct_at(position, std::move(tmp));
+    } catch (...) {
+      Base::relocate(position + 1, this->data_.finish + 1, position);
+      throw;
+    }
+    ++this->data_.finish;
   }
 };
 } // namespace s21
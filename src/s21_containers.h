@@ -2,9 +2,24 @@
 #define S21_CONTAINERS_H_
 
 #include "lib/list/s21_list.h"
+#include "lib/list/s21_intrusive_list.h"
+#include "lib/list/s21_index_list.h"
+#include "lib/unrolled_list/s21_unrolled_list.h"
 #include "lib/vector/s21_vector.h"
+#include "lib/small_vector/s21_small_vector.h"
+#include "lib/stable_vector/s21_stable_vector.h"
+#include "lib/deque/s21_deque.h"
+#include "lib/ring_buffer/s21_ring_buffer.h"
 #include "lib/stack/s21_stack.h"
 #include "lib/queue/s21_queue.h"
 #include "lib/array/s21_array.h"
+#include "lib/concurrent/s21_spsc_queue.h"
+#include "lib/concurrent/s21_mpmc_queue.h"
+#include "lib/concurrent/s21_concurrent_stack.h"
+#include "lib/concurrent/s21_ws_deque.h"
+#include "lib/concurrent/s21_thread_pool.h"
+#include "lib/allocator/s21_hugepage_allocator.h"
+#include "lib/algorithm/s21_simd.h"
+#include "lib/algorithm/s21_parallel.h"
 
 #endif // S21_CONTAINERS_H_
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "../../s21_containers.h"
+
+namespace {
+// Large enough to be split into several chunks.
+constexpr int k_count = 100003;
+
+s21::vector<int> random_vector(int count) {
+  std::mt19937 gen(static_cast<unsigned>(count));
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  s21::vector<int> result;
+  for (int i = 0; i < count; ++i) {
+    result.push_back(dist(gen));
+  }
+  return result;
+}
+} // namespace
+
+class ParallelTest : public ::testing::Test {
+ protected:
+  s21::thread_pool pool_{3};
+  s21::parallel_policy policy_ = s21::par.on(pool_);
+};
+
+TEST_F(ParallelTest, Sort) {
+  for (int count : {0, 1, 100, 5000, k_count}) {
+    auto vect = random_vector(count);
+    std::vector<int> expected(vect.begin(), vect.end());
+    std::sort(expected.begin(), expected.end());
+
+    s21::sort(policy_, vect.begin(), vect.end());
+    EXPECT_TRUE(std::equal(vect.begin(), vect.end(), expected.begin(), expected.end()));
+
+    s21::sort(policy_, vect.begin(), vect.end(), std::greater<>());
+    EXPECT_TRUE(std::is_sorted(vect.begin(), vect.end(), std::greater<>()));
+  }
+}
+
+TEST_F(ParallelTest, TransformAndForEach) {
+  auto vect = random_vector(k_count);
+  s21::vector<long> out(vect.size());
+  auto end = s21::transform(policy_, vect.begin(), vect.end(), out.begin(),
+                            [](int value) { return 2L * value; });
+  EXPECT_EQ(end, out.end());
+  for (std::size_t i = 0; i < vect.size(); ++i) {
+    ASSERT_EQ(out[i], 2L * vect[i]);
+  }
+
+  s21::transform(policy_, vect.begin(), vect.end(), out.begin(), out.begin(),
+                 [](int lhs, long rhs) { return rhs - lhs; });
+  s21::for_each(policy_, out.begin(), out.end(), [](long &value) { value -= 1; });
+  for (std::size_t i = 0; i < vect.size(); ++i) {
+    ASSERT_EQ(out[i], vect[i] - 1L);
+  }
+}
+
+TEST_F(ParallelTest, Reduce) {
+  auto vect = random_vector(k_count);
+  long expected = std::accumulate(vect.begin(), vect.end(), 5L);
+  EXPECT_EQ(s21::reduce(policy_, vect.begin(), vect.end(), 5L), expected);
+  EXPECT_EQ(s21::reduce(policy_, vect.begin(), vect.end()),
+            std::accumulate(vect.begin(), vect.end(), 0));
+  EXPECT_EQ(s21::reduce(policy_, vect.begin(), vect.end(), -5000,
+                        [](int lhs, int rhs) { return std::max(lhs, rhs); }),
+            *std::max_element(vect.begin(), vect.end()));
+  EXPECT_EQ(s21::reduce(s21::seq, vect.begin(), vect.end(), 5L), expected);
+}
+
+TEST_F(ParallelTest, InclusiveScan) {
+  auto vect = random_vector(k_count);
+  std::vector<long> expected(vect.size());
+  std::inclusive_scan(vect.begin(), vect.end(), expected.begin(), std::plus<>(), 7L);
+
+  s21::vector<long> out(vect.size());
+  s21::inclusive_scan(policy_, vect.begin(), vect.end(), out.begin(), std::plus<>(), 7L);
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin(), expected.end()));
+
+  std::inclusive_scan(vect.begin(), vect.end(), expected.begin());
+  auto end = s21::inclusive_scan(policy_, vect.begin(), vect.end(), vect.begin());
+  EXPECT_EQ(end, vect.end());
+  EXPECT_TRUE(std::equal(vect.begin(), vect.end(), expected.begin(), expected.end()));
+}
+
+TEST_F(ParallelTest, ArrayRanges) {
+  auto arr = new s21::array<int, k_count>();
+  std::iota(arr->begin(), arr->end(), 0);
+  std::reverse(arr->begin(), arr->end());
+  s21::sort(policy_, arr->begin(), arr->end());
+  EXPECT_TRUE(std::is_sorted(arr->begin(), arr->end()));
+  EXPECT_EQ(s21::reduce(policy_, arr->begin(), arr->end(), 0L), long(k_count) * (k_count - 1) / 2);
+  delete arr;
+}
+
+TEST_F(ParallelTest, ExceptionsReachTheCaller) {
+  auto vect = random_vector(k_count);
+  EXPECT_THROW(s21::for_each(policy_, vect.begin(), vect.end(),
+                             [](int value) {
+                               if (value == 1000) {
+                                 throw std::runtime_error("stop");
+                               }
+                             }),
+               std::runtime_error);
+  // The pool stays usable after a failed job
+  EXPECT_EQ(s21::reduce(policy_, vect.begin(), vect.end(), 0L),
+            std::accumulate(vect.begin(), vect.end(), 0L));
+}
+
+TEST_F(ParallelTest, NestedCalls) {
+  s21::vector<int> outer(4 * s21::parallel_details::k_min_chunk, 1);
+  s21::vector<int> inner(4 * s21::parallel_details::k_min_chunk, 1);
+  std::atomic<long> total{0};
+  s21::for_each(policy_, outer.begin(), outer.begin() + 4, [&](int) {
+    total += s21::reduce(policy_, inner.begin(), inner.end(), 0L);
+  });
+  EXPECT_EQ(total.load(), 4L * static_cast<long>(inner.size()));
+}
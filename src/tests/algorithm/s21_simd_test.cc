@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../../s21_containers.h"
+
+namespace {
+using s21::simd_details::isa;
+
+// Instruction sets the running CPU can execute, scalar included.
+std::vector<isa> supported_isas() {
+  std::vector<isa> result;
+  for (isa level : {isa::scalar, isa::sse2, isa::avx2}) {
+    if (level <= s21::simd_details::active_isa()) {
+      result.push_back(level);
+    }
+  }
+  return result;
+}
+
+template <typename T>
+std::vector<T> random_values(std::size_t count, int limit) {
+  std::mt19937 gen(static_cast<unsigned>(count));
+  std::uniform_int_distribution<int> dist(-limit, limit);
+  std::vector<T> result(count);
+  for (auto &value : result) {
+    value = static_cast<T>(dist(gen));
+  }
+  return result;
+}
+} // namespace
+
+template <typename T>
+class SimdTest : public ::testing::Test {};
+
+using SimdTypes = ::testing::Types<std::int32_t, float, double>;
+TYPED_TEST_SUITE(SimdTest, SimdTypes);
+
+TYPED_TEST(SimdTest, KernelsMatchScalar) {
+  using T = TypeParam;
+  for (std::size_t count : {0, 1, 3, 7, 8, 15, 16, 17, 33, 64, 1001}) {
+    auto values = random_values<T>(count, 50);
+    const T *data = values.data();
+    for (isa level : supported_isas()) {
+      for (T needle : {T(-50), T(0), T(7), T(51)}) {
+        auto expected_pos = std::find(values.begin(), values.end(), needle) - values.begin();
+        EXPECT_EQ(s21::simd_details::find_index(data, count, needle, level), expected_pos);
+        EXPECT_EQ(s21::simd_details::count_equal(data, count, needle, level),
+                  std::count(values.begin(), values.end(), needle));
+      }
+      EXPECT_EQ(s21::simd_details::sum(data, count, level),
+                std::accumulate(values.begin(), values.end(), T()));
+      EXPECT_EQ(s21::simd_details::extreme_index<false>(data, count, level),
+                std::min_element(values.begin(), values.end()) - values.begin());
+      EXPECT_EQ(s21::simd_details::extreme_index<true>(data, count, level),
+                std::max_element(values.begin(), values.end()) - values.begin());
+    }
+  }
+}
+
+TYPED_TEST(SimdTest, NaNKeepsStdSemantics) {
+  using T = TypeParam;
+  if constexpr (std::is_floating_point_v<T>) {
+    auto values = random_values<T>(100, 20);
+    values[0] = std::numeric_limits<T>::quiet_NaN();
+    values[40] = std::numeric_limits<T>::quiet_NaN();
+    values[60] = T(-1000);
+    for (isa level : supported_isas()) {
+      EXPECT_EQ(s21::simd_details::extreme_index<false>(values.data(), values.size(), level),
+                std::min_element(values.begin(), values.end()) - values.begin());
+      EXPECT_EQ(s21::simd_details::extreme_index<true>(values.data(), values.size(), level),
+                std::max_element(values.begin(), values.end()) - values.begin());
+      EXPECT_EQ(s21::simd_details::count_equal(values.data(), values.size(), values[0], level), 0);
+    }
+  }
+}
+
+TEST(SimdTest, VectorInterface) {
+  s21::vector<int> vect;
+  for (int i = 0; i < 1000; ++i) {
+    vect.push_back(i % 100);
+  }
+  vect[500] = -7;
+  vect[700] = 1000;
+
+  EXPECT_EQ(s21::find(vect, 42) - vect.begin(), 42);
+  EXPECT_EQ(s21::find(vect, 100), vect.end());
+  EXPECT_TRUE(s21::contains(vect, -7));
+  EXPECT_FALSE(s21::contains(vect, -8));
+  EXPECT_EQ(s21::count(vect, 42), 10);
+  EXPECT_EQ(*s21::min_element(vect), -7);
+  EXPECT_EQ(s21::max_element(vect) - vect.begin(), 700);
+  EXPECT_EQ(s21::sum(vect), 49500 - 7 + 1000);
+
+  const s21::vector<int> &cref = vect;
+  EXPECT_EQ(*s21::find(cref, 1000), 1000);
+
+  s21::vector<int> empty;
+  EXPECT_EQ(s21::min_element(empty), empty.end());
+  EXPECT_EQ(s21::sum(empty), 0);
+}
+
+TEST(SimdTest, ArrayAndScalarTypes) {
+  s21::array<float, 10> arr{3.5f, 1.0f, -2.0f, 8.0f, 8.0f, 0.0f, 1.0f, 1.0f, 2.0f, 4.0f};
+  EXPECT_EQ(s21::count(arr, 1.0f), 3);
+  EXPECT_EQ(s21::max_element(arr) - arr.begin(), 3);
+  EXPECT_EQ(s21::sum(arr), 26.5f);
+
+  s21::vector<std::int64_t> longs{5, -1, 9, 9};
+  EXPECT_EQ(s21::max_element(longs) - longs.begin(), 2);
+  EXPECT_EQ(s21::sum(longs), 22);
+  EXPECT_TRUE(s21::contains(longs, -1));
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include "../../s21_containers.h"
+
+TEST(HugepageAllocatorTest, SmallAllocationsUseHeap) {
+  s21::hugepage_allocator<int> alloc;
+  EXPECT_FALSE(alloc.is_huge(1024));
+
+  int *ptr = alloc.allocate(16);
+  ASSERT_NE(ptr, nullptr);
+  ptr[15] = 42;
+  EXPECT_EQ(ptr[15], 42);
+  alloc.deallocate(ptr, 16);
+}
+
+TEST(HugepageAllocatorTest, LargeAllocationsAreHugePageAligned) {
+  s21::hugepage_allocator<double> alloc;
+  const std::size_t count = (std::size_t(3) << 20) / sizeof(double);
+
+  double *ptr = alloc.allocate(count);
+  ASSERT_NE(ptr, nullptr);
+#ifdef __linux__
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alloc.k_huge_page_size, 0);
+#endif
+  ptr[0] = 1.0;
+  ptr[count - 1] = 2.0;
+  EXPECT_EQ(ptr[count - 1], 2.0);
+  alloc.deallocate(ptr, count);
+}
+
+TEST(HugepageAllocatorTest, VectorStorage) {
+  s21::vector<int, s21::hugepage_allocator<int>> vect;
+  const int count = 1 << 20;
+
+  for (int i = 0; i < count; ++i) {
+    vect.push_back(i);
+  }
+  EXPECT_EQ(vect.size(), static_cast<std::size_t>(count));
+#ifdef __linux__
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vect.data()) % (std::size_t(2) << 20), 0);
+#endif
+  for (int i = 0; i < count; i += 4099) {
+    EXPECT_EQ(vect[i], i);
+  }
+
+  s21::vector<std::string, s21::hugepage_allocator<std::string, 64>> strings(100, "value");
+  strings.shrink_to_fit();
+  EXPECT_EQ(strings[99], "value");
+}
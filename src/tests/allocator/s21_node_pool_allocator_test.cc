@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include "../../s21_containers.h"
+
+TEST(NodePoolAllocatorTest, FreedBlocksAreReused) {
+  s21::node_pool_allocator<double> alloc;
+
+  double *first = alloc.allocate(1);
+  double *second = alloc.allocate(1);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % alignof(double), 0);
+
+  alloc.deallocate(first, 1);
+  EXPECT_EQ(alloc.allocate(1), first);
+  alloc.deallocate(first, 1);
+  alloc.deallocate(second, 1);
+
+  double *array = alloc.allocate(8);
+  array[7] = 1.0;
+  alloc.deallocate(array, 8);
+}
+
+TEST(NodePoolAllocatorTest, CopiesAndRebindsSharePool) {
+  s21::node_pool_allocator<int> ints;
+  s21::node_pool_allocator<std::int64_t> rebound(ints);
+  s21::node_pool_allocator<int> other;
+
+  EXPECT_TRUE(ints == rebound);
+  EXPECT_FALSE(ints == other);
+
+  std::int64_t *block = rebound.allocate(1);
+  s21::node_pool_allocator<std::int64_t> copy(rebound);
+  copy.deallocate(block, 1);
+  EXPECT_EQ(rebound.allocate(1), block);
+  rebound.deallocate(block, 1);
+}
+
+TEST(NodePoolAllocatorTest, PoolList) {
+  s21::pool_list<std::string> strings;
+  const int count = 10000;
+
+  for (int i = 0; i < count; ++i) {
+    strings.push_back(std::to_string(count - i));
+  }
+  strings.sort();
+  EXPECT_EQ(strings.size(), static_cast<std::size_t>(count));
+  EXPECT_EQ(strings.front(), "1");
+  EXPECT_EQ(strings.back(), "9999");
+
+  s21::pool_list<std::string> copy(strings);
+  s21::pool_list<std::string> other{"a", "b"};
+  other.swap(strings);
+  strings.pop_front();
+  EXPECT_EQ(strings.front(), "b");
+
+  strings = std::move(copy);
+  EXPECT_EQ(strings.size(), static_cast<std::size_t>(count));
+  other.clear();
+  EXPECT_TRUE(other.empty());
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../s21_containers.h"
+
+namespace {
+// Counts allocations of every rebound type so tests can check that popped
+// nodes are reused
+std::atomic<int> allocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t count) {
+    ++allocations;
+    return std::allocator<T>().allocate(count);
+  }
+  void deallocate(T* ptr, std::size_t count) noexcept {
+    std::allocator<T>().deallocate(ptr, count);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+};
+}  // namespace
+
+TEST(ConcurrentStackTest, SingleThread) {
+  s21::concurrent_stack<std::string> stk;
+  EXPECT_TRUE(stk.empty());
+  std::string value;
+  EXPECT_FALSE(stk.try_pop(value));
+
+  stk.push("one");
+  stk.emplace(3, 'x');
+  stk.push_many({"a", "b", "c"});
+  EXPECT_FALSE(stk.empty());
+  for (const char *expected : {"c", "b", "a", "xxx", "one"}) {
+    ASSERT_TRUE(stk.try_pop(value));
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_FALSE(stk.try_pop(value));
+
+  std::vector<std::string> empty;
+  stk.push_many(empty.begin(), empty.end());
+  EXPECT_TRUE(stk.empty());
+  // Elements left in the stack are destroyed with it
+  stk.push("left");
+}
+
+TEST(ConcurrentStackTest, ReusesPoppedNodes) {
+  allocations = 0;
+  s21::concurrent_stack<int, CountingAllocator<int>> stk;
+  int value = 0;
+  for (int round = 0; round < 100; ++round) {
+    stk.push_many({1, 2, 3, 4});
+    for (int i = 0; i < 4; ++i) {
+      ASSERT_TRUE(stk.try_pop(value));
+    }
+  }
+  EXPECT_EQ(allocations.load(), 4);
+}
+
+TEST(ConcurrentStackTest, ManyThreads) {
+  constexpr int k_threads = 4;
+  constexpr int k_per_thread = 20000;
+  s21::concurrent_stack<std::unique_ptr<int>> stk;
+  std::atomic<long> sum{0};
+  std::atomic<int> popped{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < k_threads; ++t) {
+    threads.emplace_back([&, t] {
+      std::unique_ptr<int> value;
+      for (int i = 0; i < k_per_thread; ++i) {
+        if (t % 2 == 0) {
+          stk.push(std::make_unique<int>(i));
+        } else {
+          std::vector<std::unique_ptr<int>> batch;
+          batch.push_back(std::make_unique<int>(i));
+          stk.push_many(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+        }
+        if (stk.try_pop(value)) {
+          sum += *value;
+          ++popped;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  std::unique_ptr<int> value;
+  while (stk.try_pop(value)) {
+    sum += *value;
+    ++popped;
+  }
+  EXPECT_EQ(popped.load(), k_threads * k_per_thread);
+  EXPECT_EQ(sum.load(), long(k_threads) * k_per_thread * (k_per_thread - 1) / 2);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../s21_containers.h"
+
+TEST(MpmcQueueTest, SingleThread) {
+  s21::mpmc_queue<std::string> que(5);
+  EXPECT_EQ(que.capacity(), 8);
+  EXPECT_TRUE(que.empty());
+
+  std::string value;
+  EXPECT_FALSE(que.try_pop(value));
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(que.try_push(std::to_string(i)));
+  }
+  EXPECT_FALSE(que.try_push("full"));
+  EXPECT_FALSE(que.try_emplace(3, 'x'));
+  EXPECT_EQ(que.size(), 8);
+
+  for (int lap = 0; lap < 3; ++lap) {
+    for (int i = 0; i < 8; ++i) {
+      que.pop(value);
+      EXPECT_EQ(value, std::to_string(i));
+      que.push(std::to_string(i));
+    }
+  }
+  // Elements left in the queue are destroyed with it
+}
+
+TEST(MpmcQueueTest, Batches) {
+  s21::mpmc_queue<std::string> que(8);
+  std::vector<std::string> input;
+  for (int i = 0; i < 12; ++i) {
+    input.push_back(std::to_string(i));
+  }
+
+  auto first = std::make_move_iterator(input.begin());
+  EXPECT_EQ(que.try_push_n(first, 12), 8);
+
+  std::vector<std::string> output;
+  EXPECT_EQ(que.try_pop_n(std::back_inserter(output), 5), 5);
+  EXPECT_EQ(output.back(), "4");
+  EXPECT_EQ(que.try_push_n(first + 8, 4), 4);
+  que.pop_n(std::back_inserter(output), 7);
+  ASSERT_EQ(output.size(), 12);
+  for (int i = 0; i < 12; ++i) {
+    EXPECT_EQ(output[i], std::to_string(i));
+  }
+  EXPECT_EQ(que.try_pop_n(output.begin(), 3), 0);
+}
+
+TEST(MpmcQueueTest, ManyProducersAndConsumers) {
+  constexpr int k_threads = 4;
+  constexpr int k_per_thread = 20000;
+  s21::mpmc_queue<std::unique_ptr<int>> que(128);
+  std::atomic<long> sum{0};
+  std::atomic<int> received{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < k_threads; ++t) {
+    threads.emplace_back([&, t] {
+      if (t % 2 == 0) {
+        for (int i = 0; i < k_per_thread; ++i) {
+          que.push(std::make_unique<int>(i));
+        }
+      } else {
+        // Batches of four
+        std::vector<std::unique_ptr<int>> batch(4);
+        for (int i = 0; i < k_per_thread; i += 4) {
+          for (int j = 0; j < 4; ++j) {
+            batch[j] = std::make_unique<int>(i + j);
+          }
+          que.push_n(std::make_move_iterator(batch.begin()), 4);
+        }
+      }
+    });
+    threads.emplace_back([&, t] {
+      std::unique_ptr<int> value;
+      std::vector<std::unique_ptr<int>> batch(8);
+      for (int count = 0; count < k_per_thread;) {
+        if (t % 2 == 0) {
+          que.pop(value);
+          sum += *value;
+          ++count;
+        } else {
+          auto popped = que.try_pop_n(batch.begin(), std::min(8, k_per_thread - count));
+          for (std::size_t j = 0; j < popped; ++j) {
+            sum += *batch[j];
+          }
+          count += static_cast<int>(popped);
+          if (popped == 0) {
+            std::this_thread::yield();
+          }
+        }
+      }
+      received += k_per_thread;
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(received.load(), k_threads * k_per_thread);
+  EXPECT_EQ(sum.load(), long(k_threads) * k_per_thread * (k_per_thread - 1) / 2);
+  EXPECT_TRUE(que.empty());
+}
+
+namespace {
+// Accepts limit values, then throws as a full back_inserter would.
+struct ThrowingSink {
+  using difference_type = std::ptrdiff_t;
+
+  ThrowingSink &operator*() { return *this; }
+  ThrowingSink &operator++() { return *this; }
+  ThrowingSink operator++(int) { return *this; }
+  ThrowingSink &operator=(std::string &&value) {
+    if (output->size() == limit) {
+      throw std::bad_alloc();
+    }
+    output->push_back(std::move(value));
+    return *this;
+  }
+
+  std::vector<std::string> *output;
+  std::size_t limit;
+};
+}  // namespace
+
+TEST(MpmcQueueTest, ThrowingOutputReleasesSlots) {
+  s21::mpmc_queue<std::string> que(4);
+  for (int i = 0; i < 4; ++i) {
+    que.push(std::to_string(i));
+  }
+  std::vector<std::string> output;
+  EXPECT_THROW(que.try_pop_n(ThrowingSink{&output, 2}, 4), std::bad_alloc);
+  ASSERT_EQ(output.size(), 2);
+  EXPECT_EQ(output[1], "1");
+  EXPECT_TRUE(que.empty());
+
+  for (int lap = 0; lap < 3; ++lap) {
+    std::vector<std::string> input(4, "x");
+    EXPECT_EQ(que.try_push_n(std::make_move_iterator(input.begin()), 4), 4);
+    EXPECT_EQ(que.try_pop_n(std::back_inserter(output), 4), 4);
+  }
+  EXPECT_EQ(output.size(), 14);
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include "../../s21_containers.h"
+
+TEST(SpscQueueTest, SingleThread) {
+  s21::spsc_queue<std::string> que(3);
+  EXPECT_EQ(que.capacity(), 4);
+  EXPECT_TRUE(que.empty());
+  EXPECT_EQ(que.front(), nullptr);
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(que.try_push(std::to_string(i)));
+  }
+  EXPECT_FALSE(que.try_push("full"));
+  EXPECT_EQ(que.size(), 4);
+
+  std::string value;
+  EXPECT_TRUE(que.try_pop(value));
+  EXPECT_EQ(value, "0");
+  EXPECT_EQ(*que.front(), "1");
+  que.pop();
+  que.push("4");
+  EXPECT_TRUE(que.try_emplace(3, 'x'));
+  for (const char *expected : {"2", "3", "4", "xxx"}) {
+    ASSERT_TRUE(que.try_pop(value));
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_FALSE(que.try_pop(value));
+  // Elements left in the queue are destroyed with it
+  que.push("left");
+}
+
+TEST(SpscQueueTest, HandsOffInOrder) {
+  constexpr int k_count = 200000;
+  s21::spsc_queue<std::unique_ptr<int>> que(64);
+
+  std::thread producer([&] {
+    for (int i = 0; i < k_count; ++i) {
+      que.push(std::make_unique<int>(i));
+    }
+  });
+
+  std::unique_ptr<int> value;
+  for (int expected = 0; expected < k_count;) {
+    if (que.try_pop(value)) {
+      ASSERT_EQ(*value, expected);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(que.empty());
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "../../s21_containers.h"
+
+TEST(ThreadPoolTest, SubmitAndWaitAll) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.concurrency(), 4);
+  std::atomic<int> sum{0};
+  for (int i = 0; i < 1000; ++i) {
+    pool.submit([&sum, i] { sum += i; });
+  }
+  pool.wait_all();
+  EXPECT_EQ(sum.load(), 999 * 1000 / 2);
+
+  // Tasks submitted from tasks go to the worker's own deque
+  std::atomic<int> leaves{0};
+  for (int i = 0; i < 10; ++i) {
+    pool.submit([&] {
+      for (int j = 0; j < 10; ++j) {
+        pool.submit([&] { ++leaves; });
+      }
+    });
+  }
+  pool.wait_all();
+  EXPECT_EQ(leaves.load(), 100);
+}
+
+TEST(ThreadPoolTest, WaitAllRethrows) {
+  s21::thread_pool pool(2);
+  std::atomic<int> ran{0};
+  for (int i = 0; i < 20; ++i) {
+    pool.submit([&ran, i] {
+      ++ran;
+      if (i == 7) {
+        throw std::runtime_error("task failed");
+      }
+    });
+  }
+  EXPECT_THROW(pool.wait_all(), std::runtime_error);
+  EXPECT_EQ(ran.load(), 20);
+  // The error is reported once
+  EXPECT_NO_THROW(pool.wait_all());
+}
+
+TEST(ThreadPoolTest, ParallelFor) {
+  s21::thread_pool pool(3);
+  std::vector<std::atomic<int>> hits(10000);
+  pool.parallel_for(hits.size(), [&](std::size_t i) { ++hits[i]; });
+  for (auto &hit : hits) {
+    ASSERT_EQ(hit.load(), 1);
+  }
+
+  // Nested calls from inside tasks help instead of blocking a worker
+  std::atomic<long> total{0};
+  pool.parallel_for(8, [&](std::size_t) {
+    pool.parallel_for(100, [&](std::size_t j) { total += static_cast<long>(j); });
+  });
+  EXPECT_EQ(total.load(), 8L * 99 * 100 / 2);
+
+  EXPECT_THROW(pool.parallel_for(100, [](std::size_t i) {
+                 if (i == 50) {
+                   throw std::logic_error("index");
+                 }
+               }),
+               std::logic_error);
+}
+
+TEST(ThreadPoolTest, WithoutWorkers) {
+  s21::thread_pool pool(0);
+  int sum = 0;
+  pool.parallel_for(10, [&](std::size_t i) { sum += static_cast<int>(i); });
+  pool.submit([&] { sum += 100; });
+  pool.wait_all();
+  EXPECT_EQ(sum, 145);
+}
+
+TEST(ThreadPoolTest, DestructorRunsQueuedTasks) {
+  std::atomic<int> ran{0};
+  {
+    s21::thread_pool pool(2);
+    for (int i = 0; i < 100; ++i) {
+      pool.submit([&] { ++ran; });
+    }
+  }
+  EXPECT_EQ(ran.load(), 100);
+}
+
+namespace {
+double ThreadCpuSeconds() {
+  timespec now{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  return static_cast<double>(now.tv_sec) + static_cast<double>(now.tv_nsec) * 1e-9;
+}
+}  // namespace
+
+TEST(ThreadPoolTest, WaiterSleepsWhileTasksRun) {
+  s21::thread_pool pool(1);
+  std::atomic<bool> started{false};
+  pool.submit([&started] {
+    started = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  });
+  while (!started) {
+    std::this_thread::yield();
+  }
+
+  double cpu_before = ThreadCpuSeconds();
+  pool.wait_all();
+  // A waiter spinning on yield() would burn most of the 300 ms
+  EXPECT_LT(ThreadCpuSeconds() - cpu_before, 0.1);
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../../s21_containers.h"
+
+TEST(WsDequeTest, OwnerIsLifoThievesAreFifo) {
+  s21::ws_deque<int> deq(2);
+  EXPECT_TRUE(deq.empty());
+  EXPECT_FALSE(deq.pop());
+  EXPECT_FALSE(deq.steal());
+
+  for (int i = 0; i < 10; ++i) {
+    deq.push(i);
+  }
+  EXPECT_EQ(deq.size(), 10);
+  EXPECT_GE(deq.capacity(), 10);
+  EXPECT_EQ(deq.pop(), 9);
+  EXPECT_EQ(deq.steal(), 0);
+  EXPECT_EQ(deq.steal(), 1);
+  EXPECT_EQ(deq.pop(), 8);
+  for (int expected = 7; expected >= 2; --expected) {
+    EXPECT_EQ(deq.pop(), expected);
+  }
+  EXPECT_FALSE(deq.pop());
+  EXPECT_FALSE(deq.steal());
+}
+
+TEST(WsDequeTest, EveryElementIsTakenOnce) {
+  constexpr int k_count = 100000;
+  constexpr int k_thieves = 3;
+  s21::ws_deque<int> deq(4);
+  std::vector<std::atomic<int>> taken(k_count);
+  std::atomic<bool> done{false};
+
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < k_thieves; ++t) {
+    thieves.emplace_back([&] {
+      while (!done.load() || !deq.empty()) {
+        if (auto value = deq.steal()) {
+          ++taken[*value];
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (int i = 0; i < k_count; ++i) {
+    deq.push(i);
+    if (i % 3 == 0) {
+      if (auto value = deq.pop()) {
+        ++taken[*value];
+      }
+    }
+  }
+  while (auto value = deq.pop()) {
+    ++taken[*value];
+  }
+  done = true;
+  for (auto &thief : thieves) {
+    thief.join();
+  }
+  for (int i = 0; i < k_count; ++i) {
+    ASSERT_EQ(taken[i].load(), 1) << i;
+  }
+}
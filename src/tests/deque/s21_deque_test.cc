@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include "../../s21_containers.h"
+
+namespace {
+// Tracks live allocations so tests can check that blocks are released
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  inline static int live = 0;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t count) {
+    ++live;
+    return std::allocator<T>().allocate(count);
+  }
+  void deallocate(T* ptr, std::size_t count) noexcept {
+    --live;
+    std::allocator<T>().deallocate(ptr, count);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+};
+}  // namespace
+
+TEST(DequeTest, PushPopBothEnds) {
+  s21::deque<int, std::allocator<int>, 4> deq;
+  std::deque<int> expected;
+  EXPECT_TRUE(deq.empty());
+
+  for (int i = 0; i < 50; ++i) {
+    deq.push_back(i);
+    deq.push_front(-i);
+    expected.push_back(i);
+    expected.push_front(-i);
+  }
+  ASSERT_EQ(deq.size(), expected.size());
+  EXPECT_TRUE(std::equal(deq.begin(), deq.end(), expected.begin(), expected.end()));
+  EXPECT_EQ(deq.front(), -49);
+  EXPECT_EQ(deq.back(), 49);
+  EXPECT_EQ(deq[50], 0);
+  EXPECT_THROW(deq.at(100), std::out_of_range);
+
+  for (int i = 0; i < 30; ++i) {
+    deq.pop_front();
+    deq.pop_back();
+  }
+  EXPECT_EQ(deq.size(), 40);
+  EXPECT_EQ(deq.front(), -19);
+  EXPECT_EQ(deq.back(), 19);
+}
+
+TEST(DequeTest, MatchesStdDequeRandomly) {
+  s21::deque<std::string, std::allocator<std::string>, 8> deq;
+  std::deque<std::string> expected;
+  std::mt19937 gen(42);
+  for (int step = 0; step < 20000; ++step) {
+    auto value = std::to_string(step);
+    switch (gen() % 4) {
+      case 0: deq.push_back(value); expected.push_back(value); break;
+      case 1: deq.emplace_front(value); expected.push_front(value); break;
+      case 2:
+        if (!expected.empty()) { deq.pop_back(); expected.pop_back(); }
+        break;
+      default:
+        if (!expected.empty()) { deq.pop_front(); expected.pop_front(); }
+        break;
+    }
+    ASSERT_EQ(deq.size(), expected.size());
+  }
+  EXPECT_TRUE(std::equal(deq.begin(), deq.end(), expected.begin(), expected.end()));
+}
+
+TEST(DequeTest, BlocksGoThroughTheAllocator) {
+  using counted = s21::deque<int, CountingAllocator<int>, 16>;
+  CountingAllocator<int>::live = 0;
+  CountingAllocator<int *>::live = 0;
+  {
+    counted deq;
+    EXPECT_EQ(CountingAllocator<int>::live, 0);
+    for (int i = 0; i < 1000; ++i) {
+      deq.push_back(i);
+    }
+    EXPECT_EQ(CountingAllocator<int>::live, 63);
+    EXPECT_EQ(CountingAllocator<int *>::live, 1);
+
+    // A queue-like pattern keeps a bounded number of blocks alive
+    for (int i = 0; i < 100000; ++i) {
+      deq.push_back(i);
+      deq.pop_front();
+    }
+    EXPECT_LE(CountingAllocator<int>::live, 64);
+    EXPECT_EQ(CountingAllocator<int *>::live, 1);
+  }
+  EXPECT_EQ(CountingAllocator<int>::live, 0);
+  EXPECT_EQ(CountingAllocator<int *>::live, 0);
+}
+
+TEST(DequeTest, ConstructAssignAndSwap) {
+  s21::deque<std::string> strings(3, "abc");
+  EXPECT_EQ(strings.size(), 3);
+  EXPECT_EQ(strings[2], "abc");
+
+  s21::deque<std::string> copy(strings);
+  copy.push_back("d");
+  EXPECT_EQ(strings.size(), 3);
+  EXPECT_EQ(copy.back(), "d");
+
+  s21::deque<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 4);
+
+  strings = {"x", "y"};
+  moved.swap(strings);
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(strings.size(), 4);
+
+  strings = std::move(moved);
+  EXPECT_EQ(strings.front(), "x");
+
+  s21::deque<int> ints{1, 2, 3};
+  ints.resize(1000);
+  EXPECT_EQ(ints[999], 0);
+  ints.resize(2, 7);
+  EXPECT_EQ(ints.size(), 2);
+  ints.resize(4, 7);
+  EXPECT_EQ(ints[3], 7);
+
+  s21::vector<int> vect{5, 6, 7};
+  s21::deque<int> from_range(vect.begin(), vect.end());
+  EXPECT_EQ(from_range.back(), 7);
+  ints.clear();
+  EXPECT_TRUE(ints.empty());
+  ints.push_front(1);
+  EXPECT_EQ(ints.front(), 1);
+}
+
+TEST(DequeTest, RandomAccessIterators) {
+  s21::deque<int, std::allocator<int>, 8> deq;
+  for (int i = 0; i < 100; ++i) {
+    deq.push_front(i);
+  }
+  std::sort(deq.begin(), deq.end());
+  EXPECT_TRUE(std::is_sorted(deq.cbegin(), deq.cend()));
+  EXPECT_EQ(deq.end() - deq.begin(), 100);
+  EXPECT_EQ(deq.begin()[42], 42);
+  s21::deque<int, std::allocator<int>, 8>::const_iterator it = deq.begin() + 10;
+  EXPECT_EQ(*it, 10);
+  static_assert(std::random_access_iterator<s21::deque<int>::iterator>);
+  static_assert(std::random_access_iterator<s21::deque<int>::const_iterator>);
+}
+
+TEST(DequeTest, DefaultContainerOfAdapters) {
+  s21::stack<int> stk{1, 2, 3};
+  stk.push(4);
+  EXPECT_EQ(stk.top(), 4);
+  stk.pop();
+  EXPECT_EQ(stk.top(), 3);
+  EXPECT_EQ(stk.size(), 3);
+
+  s21::queue<std::string> que{"a", "b"};
+  que.push("c");
+  EXPECT_EQ(que.front(), "a");
+  EXPECT_EQ(que.back(), "c");
+  que.pop();
+  EXPECT_EQ(que.front(), "b");
+  EXPECT_EQ(que.size(), 2);
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../../s21_containers.h"
+#include "../s21_list_test_helpers.h"
+
+using s21_test::ExpectSame;
+
+namespace {
+int index_allocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t count) {
+    ++index_allocations;
+    return std::allocator<T>().allocate(count);
+  }
+  void deallocate(T* ptr, std::size_t count) noexcept {
+    std::allocator<T>().deallocate(ptr, count);
+  }
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+};
+}  // namespace
+
+TEST(IndexListTest, RandomInsertAndEraseReuseSlots) {
+  s21::index_list<int> values;
+  std::list<int> expected;
+  std::mt19937 random(7);
+
+  for (int step = 0; step < 4000; ++step) {
+    std::size_t offset = expected.empty() ? 0 : random() % (expected.size() + 1);
+    auto iter = std::next(values.begin(), offset);
+    auto expected_iter = std::next(expected.begin(), offset);
+    if (random() % 3 != 0 || expected_iter == expected.end()) {
+      auto inserted = values.insert(iter, step);
+      expected.insert(expected_iter, step);
+      ASSERT_EQ(*inserted, step);
+    } else {
+      auto next = values.erase(iter);
+      auto expected_next = expected.erase(expected_iter);
+      ASSERT_EQ(next == values.end(), expected_next == expected.end());
+    }
+  }
+  ExpectSame(values, expected);
+
+  std::size_t capacity = values.capacity();
+  std::size_t size = values.size();
+  values.erase(std::next(values.begin(), 10), std::next(values.begin(), 110));
+  for (int i = 0; i < 100; ++i) {
+    values.push_front(i);
+  }
+  EXPECT_EQ(values.size(), size);
+  EXPECT_EQ(values.capacity(), capacity);
+}
+
+TEST(IndexListTest, IteratorsSurviveGrowth) {
+  s21::index_list<std::string> strings{"first", "second"};
+  auto second = std::next(strings.begin());
+  for (int i = 0; i < 1000; ++i) {
+    strings.push_back(std::to_string(i));
+  }
+  EXPECT_EQ(*second, "second");
+  EXPECT_EQ(*--second, "first");
+
+  strings.push_back(strings.front());
+  EXPECT_EQ(strings.back(), "first");
+  strings.pop_back();
+  strings.pop_front();
+  EXPECT_EQ(strings.front(), "second");
+}
+
+TEST(IndexListTest, CompactRenumbersInOrder) {
+  s21::index_list<int> values{5, 1, 4};
+  values.push_front(0);
+  values.erase(std::next(values.begin()), std::next(values.begin(), 3));
+  values.insert(std::next(values.begin()), 3);
+  std::list<int> expected{0, 3, 4};
+  EXPECT_NE(values.begin().index(), 0);
+
+  values.compact();
+  ExpectSame(values, expected);
+  EXPECT_EQ(values.capacity(), 3);
+  std::uint32_t index = 0;
+  for (auto iter = values.begin(); iter != values.end(); ++iter) {
+    EXPECT_EQ(iter.index(), index++);
+  }
+
+  values.clear();
+  values.compact();
+  EXPECT_TRUE(values.empty());
+  EXPECT_EQ(values.begin(), values.end());
+}
+
+TEST(IndexListTest, CopyMoveAndSwap) {
+  s21::index_list<std::string> strings{"a", "b", "c", "d"};
+  strings.erase(std::next(strings.begin()));
+  s21::index_list<std::string> copy(strings);
+  strings.push_back("e");
+  copy.push_back("f");
+  ExpectSame(copy, std::list<std::string>{"a", "c", "d", "f"});
+
+  s21::index_list<std::string> moved(std::move(strings));
+  EXPECT_TRUE(strings.empty());
+  ExpectSame(moved, std::list<std::string>{"a", "c", "d", "e"});
+
+  strings = copy;
+  copy = std::move(moved);
+  moved.swap(strings);
+  EXPECT_TRUE(strings.empty());
+  EXPECT_EQ(moved.back(), "f");
+  EXPECT_EQ(copy.back(), "e");
+
+  s21::index_list<std::unique_ptr<int>> owned;
+  owned.emplace_back(new int(2));
+  owned.emplace_front(new int(1));
+  auto last = owned.insert_many(owned.cend(), std::make_unique<int>(3), std::make_unique<int>(4));
+  EXPECT_EQ(**last, 4);
+  owned.pop_front();
+  owned.compact();
+  EXPECT_EQ(*owned.front(), 2);
+}
+
+TEST(IndexListTest, SpliceMergeSort) {
+  s21::index_list<int> values{1, 2, 3, 4, 5, 6, 7};
+  s21::index_list<int> other{10, 11, 12};
+  std::list<int> expected{1, 2, 3, 4, 5, 6, 7};
+  std::list<int> expected_other{10, 11, 12};
+
+  values.splice(std::next(values.cbegin(), 2), other);
+  expected.splice(std::next(expected.cbegin(), 2), expected_other);
+  EXPECT_TRUE(other.empty());
+  ExpectSame(values, expected);
+
+  values.splice(values.cbegin(), values, std::next(values.cbegin(), 5), std::next(values.cbegin(), 8));
+  expected.splice(expected.cbegin(), expected, std::next(expected.cbegin(), 5), std::next(expected.cbegin(), 8));
+  ExpectSame(values, expected);
+
+  values.splice(values.cend(), values, values.cbegin());
+  expected.splice(expected.cend(), expected, expected.cbegin());
+  ExpectSame(values, expected);
+
+  values.sort();
+  expected.sort();
+  ExpectSame(values, expected);
+
+  s21::index_list<int> odds{1, 3, 5, 7, 9, 11};
+  std::list<int> expected_odds{1, 3, 5, 7, 9, 11};
+  values.merge(odds);
+  expected.merge(expected_odds);
+  EXPECT_TRUE(odds.empty());
+  ExpectSame(values, expected);
+
+  values.unique();
+  expected.unique();
+  ExpectSame(values, expected);
+
+  values.reverse();
+  expected.reverse();
+  ExpectSame(values, expected);
+}
+
+TEST(IndexListTest, SpliceOntoItselfIsNoOp) {
+  s21::index_list<int> values{1, 2, 3};
+  auto iter = std::next(values.cbegin());
+  values.splice(iter, values, iter);
+  ExpectSame(values, std::list<int>{1, 2, 3});
+  values.splice(std::next(iter), values, iter);
+  ExpectSame(values, std::list<int>{1, 2, 3});
+  values.splice(values.cbegin(), values, values.cbegin(), values.cend());
+  ExpectSame(values, std::list<int>{1, 2, 3});
+}
+
+TEST(IndexListTest, SortIsStable) {
+  s21::index_list<std::pair<int, int>> pairs;
+  std::list<std::pair<int, int>> expected;
+  for (int i = 0; i < 500; ++i) {
+    pairs.emplace_back(i % 7, i);
+    expected.emplace_back(i % 7, i);
+  }
+  auto by_key = [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; };
+  pairs.sort(by_key);
+  expected.sort(by_key);
+  ExpectSame(pairs, expected);
+}
+
+TEST(IndexListTest, SortBufferUsesListAllocator) {
+  s21::index_list<int, CountingAllocator<int>> values{5, 3, 9, 1, 7, 2};
+  int before = index_allocations;
+  values.sort();
+  EXPECT_GT(index_allocations, before);
+  ExpectSame(values, std::list<int>{1, 2, 3, 5, 7, 9});
+}
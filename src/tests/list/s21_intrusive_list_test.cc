@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "../../s21_containers.h"
+
+namespace {
+struct Timer {
+  explicit Timer(int id_value = 0) : id(id_value) {}
+
+  int id;
+  s21::intrusive_list_hook by_deadline;
+  s21::intrusive_list_hook by_owner;
+};
+
+using deadline_list = s21::intrusive_list<Timer, &Timer::by_deadline>;
+using owner_list = s21::intrusive_list<Timer, &Timer::by_owner>;
+
+std::vector<int> Ids(const deadline_list &timers) {
+  std::vector<int> ids;
+  for (const auto &timer : timers) {
+    ids.push_back(timer.id);
+  }
+  return ids;
+}
+}  // namespace
+
+TEST(IntrusiveListTest, LinksObjectsInPlace) {
+  std::vector<Timer> timers;
+  for (int i = 0; i < 5; ++i) {
+    timers.emplace_back(i);
+  }
+  deadline_list deadlines;
+  owner_list owned;
+  for (auto &timer : timers) {
+    deadlines.push_back(timer);
+    owned.push_front(timer);
+  }
+  EXPECT_EQ(deadlines.size(), 5);
+  EXPECT_EQ(&deadlines.front(), &timers[0]);
+  EXPECT_EQ(&owned.front(), &timers[4]);
+  EXPECT_TRUE(timers[2].by_deadline.is_linked());
+
+  deadlines.remove(timers[2]);
+  EXPECT_FALSE(timers[2].by_deadline.is_linked());
+  EXPECT_TRUE(timers[2].by_owner.is_linked());
+  EXPECT_EQ(Ids(deadlines), (std::vector<int>{0, 1, 3, 4}));
+
+  auto iter = deadlines.iterator_to(timers[3]);
+  EXPECT_EQ(iter->id, 3);
+  deadlines.insert(iter, timers[2]);
+  deadlines.erase(deadlines.iterator_to(timers[0]));
+  deadlines.pop_back();
+  EXPECT_EQ(Ids(deadlines), (std::vector<int>{1, 2, 3}));
+
+  Timer copy(timers[1]);
+  EXPECT_FALSE(copy.by_deadline.is_linked());
+
+  deadlines.clear();
+  owned.clear();
+  EXPECT_TRUE(std::none_of(timers.begin(), timers.end(), [](const Timer &timer) {
+    return timer.by_deadline.is_linked() || timer.by_owner.is_linked();
+  }));
+}
+
+TEST(IntrusiveListTest, SpliceSortReverse) {
+  std::vector<Timer> timers;
+  for (int id : {5, 1, 4, 2, 3, 0}) {
+    timers.emplace_back(id);
+  }
+  deadline_list first;
+  deadline_list second;
+  for (std::size_t i = 0; i < timers.size(); ++i) {
+    (i < 3 ? first : second).push_back(timers[i]);
+  }
+
+  first.splice(first.cbegin(), second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(Ids(first), (std::vector<int>{2, 3, 0, 5, 1, 4}));
+
+  second.splice(second.cend(), first, first.iterator_to(timers[0]));
+  EXPECT_EQ(second.size(), 1);
+  EXPECT_EQ(first.size(), 5);
+
+  first.sort([](const Timer &lhs, const Timer &rhs) { return lhs.id < rhs.id; });
+  EXPECT_EQ(Ids(first), (std::vector<int>{0, 1, 2, 3, 4}));
+  first.reverse();
+  EXPECT_EQ(Ids(first), (std::vector<int>{4, 3, 2, 1, 0}));
+
+  deadline_list moved(std::move(first));
+  EXPECT_TRUE(first.empty());
+  moved.swap(second);
+  EXPECT_EQ(Ids(moved), (std::vector<int>{5}));
+  EXPECT_EQ(second.size(), 5);
+  EXPECT_EQ(second.back().id, 0);
+}
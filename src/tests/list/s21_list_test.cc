@@ -1,7 +1,15 @@
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <list>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 // #define TESTS
 #include "../../lib/list/s21_list.h"
+#include "../../lib/vector/s21_vector.h"
 
 // Фикстура для тестирования класса s21::list
 class S21ListTest : public ::testing::Test {
@@ -666,4 +674,216 @@ TEST(S21ListClassTest, CustomTypeTest) {
   } catch (const std::exception& e) {
     FAIL() << "Exception thrown in custom type test: " << e.what();
   }
-}
\ No newline at end of file
+}
+TEST_F(S21ListTest, RangeConstructorAndAssign) {
+  std::vector<int> source{7, 8, 9};
+  s21::list<int> s21_range(source.begin(), source.end());
+  compare_lists(s21_range, std::list<int>(source.begin(), source.end()));
+
+  s21_list_->assign(3, 4);
+  compare_lists(*s21_list_, std::list<int>(3, 4));
+  s21_list_->assign({1, 2, 3, 4, 5, 6});
+  compare_lists(*s21_list_, std::list<int>{1, 2, 3, 4, 5, 6});
+  s21_list_->assign(source.begin(), source.end());
+  compare_lists(*s21_list_, std::list<int>{7, 8, 9});
+
+  std::istringstream input("1 2 3");
+  s21_empty_list_->assign(std::istream_iterator<int>(input), std::istream_iterator<int>());
+  compare_lists(*s21_empty_list_, std::list<int>{1, 2, 3});
+}
+
+TEST(S21ListClassTest, BulkNodesAreContiguous) {
+  s21::pool_list<long> s21_bulk(1000, 5);
+  ASSERT_EQ(s21_bulk.size(), 1000);
+
+  using node = s21::pool_list<long>::list_node;
+  auto prev = s21_bulk.begin();
+  for (auto it = ++s21_bulk.begin(); it != s21_bulk.end(); ++it, ++prev) {
+    EXPECT_EQ(static_cast<node*>(it.current_), static_cast<node*>(prev.current_) + 1);
+  }
+  s21_bulk.assign({1, 2});
+  EXPECT_EQ(s21_bulk.size(), 2);
+  EXPECT_EQ(s21_bulk.back(), 2);
+}
+
+TEST(S21ListClassTest, BulkConstructionIsExceptionSafe) {
+  struct Fragile {
+    explicit Fragile(int number) : value(number) {}
+    Fragile(const Fragile &other) : value(other.value) {
+      if (value == 3) {
+        throw std::runtime_error("copy");
+      }
+    }
+    int value;
+  };
+  std::vector<Fragile> source;
+  source.reserve(4);
+  for (int i = 1; i <= 4; ++i) {
+    source.emplace_back(i);
+  }
+  using pool_type = s21::pool_list<Fragile>;
+  EXPECT_THROW(pool_type(source.begin(), source.end()), std::runtime_error);
+  using plain_type = s21::list<Fragile>;
+  EXPECT_THROW(plain_type(source.begin(), source.end()), std::runtime_error);
+}
+
+TEST(S21ListClassTest, SortWithCompareIsStable) {
+  std::vector<std::pair<int, int>> source;
+  for (int i = 0; i < 1000; ++i) {
+    source.emplace_back((i * 7919) % 13, i);
+  }
+  s21::list<std::pair<int, int>> s21_pairs(source.begin(), source.end());
+  std::list<std::pair<int, int>> std_pairs(source.begin(), source.end());
+  auto by_key = [](const auto &lhs, const auto &rhs) { return lhs.first > rhs.first; };
+  s21_pairs.sort(by_key);
+  std_pairs.sort(by_key);
+
+  ASSERT_EQ(s21_pairs.size(), std_pairs.size());
+  EXPECT_TRUE(std::equal(s21_pairs.begin(), s21_pairs.end(), std_pairs.begin()));
+  EXPECT_EQ(&*--s21_pairs.end(), &s21_pairs.back());
+}
+
+TEST(S21ListClassTest, SortKeepsElementsWhenCompareThrows) {
+  s21::list<int> s21_values;
+  for (int i = 0; i < 100; ++i) {
+    s21_values.push_back(100 - i);
+  }
+  int calls = 0;
+  auto fragile = [&calls](int lhs, int rhs) {
+    if (++calls == 150) {
+      throw std::runtime_error("compare");
+    }
+    return lhs < rhs;
+  };
+  EXPECT_THROW(s21_values.sort(fragile), std::runtime_error);
+
+  ASSERT_EQ(s21_values.size(), 100);
+  std::vector<int> seen(s21_values.begin(), s21_values.end());
+  std::sort(seen.begin(), seen.end());
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(seen[i], i + 1);
+  }
+  int backwards = 0;
+  for (auto it = s21_values.end(); it != s21_values.begin(); --it) {
+    ++backwards;
+  }
+  EXPECT_EQ(backwards, 100);
+}
+
+TEST(S21ListClassTest, SpliceWithinList) {
+  s21::list<int> s21_values{1, 2, 3, 4, 5};
+  std::list<int> std_values{1, 2, 3, 4, 5};
+
+  s21_values.splice(s21_values.cbegin(), s21_values, ++s21_values.cbegin());
+  std_values.splice(std_values.cbegin(), std_values, ++std_values.cbegin());
+  s21_values.splice(s21_values.cbegin(), s21_values, s21_values.cbegin());
+  std_values.splice(std_values.cbegin(), std_values, std_values.cbegin());
+  auto s21_first = s21_values.cbegin();
+  auto std_first = std_values.cbegin();
+  std::advance(s21_first, 3);
+  std::advance(std_first, 3);
+  s21_values.splice(s21_values.cbegin(), s21_values, s21_first, s21_values.cend());
+  std_values.splice(std_values.cbegin(), std_values, std_first, std_values.cend());
+
+  ASSERT_EQ(s21_values.size(), std_values.size());
+  EXPECT_TRUE(std::equal(s21_values.begin(), s21_values.end(), std_values.begin()));
+  EXPECT_EQ(s21_values.back(), std_values.back());
+
+  s21::list<int> s21_moved(std::move(s21_values));
+  EXPECT_EQ(s21_moved.size(), 5);
+  EXPECT_TRUE(s21_values.empty());
+  s21_values = std::move(s21_moved);
+  EXPECT_EQ(s21_values.size(), 5);
+  EXPECT_EQ(s21_values.front(), std_values.front());
+}
+
+TEST(S21ListClassTest, EmplaceAndMoveOnlyValues) {
+  s21::list<std::unique_ptr<int>> s21_owned;
+  s21_owned.push_back(std::make_unique<int>(2));
+  s21_owned.emplace_front(new int(1));
+  auto it = s21_owned.emplace(s21_owned.cend(), std::make_unique<int>(4));
+  s21_owned.insert(it, std::make_unique<int>(3));
+  *s21_owned.emplace_back(new int(0)) = 5;
+
+  int expected = 1;
+  for (const auto &value : s21_owned) {
+    EXPECT_EQ(*value, expected++);
+  }
+  s21_owned.sort([](const auto &lhs, const auto &rhs) { return *lhs > *rhs; });
+  EXPECT_EQ(*s21_owned.front(), 5);
+
+  s21::list<std::string> s21_strings;
+  std::string moved(100, 'x');
+  auto last = s21_strings.insert_many(s21_strings.cbegin(), std::string("a"), std::move(moved));
+  EXPECT_EQ(last->size(), 100);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(s21_strings.emplace_back(3, 'b'), "bbb");
+  EXPECT_EQ(s21_strings.size(), 3);
+}
+
+namespace {
+int list_allocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t count) {
+    ++list_allocations;
+    return std::allocator<T>().allocate(count);
+  }
+  void deallocate(T* ptr, std::size_t count) noexcept {
+    std::allocator<T>().deallocate(ptr, count);
+  }
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+};
+}  // namespace
+
+TEST(S21ListClassTest, EmptyListsDoNotAllocate) {
+  using counted_list = s21::list<int, CountingAllocator<int>>;
+  static_assert(std::is_nothrow_move_constructible_v<counted_list>);
+  list_allocations = 0;
+
+  counted_list s21_empty;
+  counted_list s21_moved(std::move(s21_empty));
+  s21::vector<counted_list> buckets(100);
+  EXPECT_EQ(list_allocations, 0);
+
+  counted_list s21_values{1, 2, 3};
+  EXPECT_EQ(list_allocations, 3);
+  s21_values.sort();
+  s21_empty.swap(s21_values);
+  EXPECT_EQ(list_allocations, 3);
+  EXPECT_TRUE(s21_values.empty());
+  EXPECT_EQ(s21_values.begin(), s21_values.end());
+  ASSERT_EQ(s21_empty.size(), 3);
+  EXPECT_EQ(s21_empty.back(), 3);
+  EXPECT_EQ(*--s21_empty.end(), 3);
+
+  s21_values.push_back(4);
+  s21_empty.swap(s21_values);
+  EXPECT_EQ(s21_empty.front(), 4);
+  EXPECT_EQ(s21_values.front(), 1);
+  s21_values.swap(s21_moved);
+  EXPECT_TRUE(s21_values.empty());
+  EXPECT_EQ(s21_moved.size(), 3);
+}
+
+TEST(S21ListClassTest, MoveWithUnequalAllocatorMovesValues) {
+  using owned_list = s21::pool_list<std::unique_ptr<int>>;
+  owned_list source;
+  source.emplace_back(new int(1));
+  source.push_back(std::make_unique<int>(2));
+
+  s21::node_pool_allocator<std::unique_ptr<int>> other_pool;
+  owned_list moved(std::move(source), other_pool);
+  EXPECT_TRUE(source.empty());
+  ASSERT_EQ(moved.size(), 2);
+  EXPECT_EQ(*moved.front(), 1);
+  EXPECT_EQ(*moved.back(), 2);
+}
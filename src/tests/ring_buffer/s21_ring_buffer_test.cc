@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <deque>
+#include <memory>
+#include <string>
+#include "../../s21_containers.h"
+
+TEST(RingBufferTest, CapacityIsRoundedToPowerOfTwo) {
+  s21::ring_buffer<int> empty;
+  EXPECT_EQ(empty.capacity(), 0);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.full());
+  EXPECT_THROW(empty.push_back(1), std::length_error);
+
+  s21::ring_buffer<int> ring(100);
+  EXPECT_EQ(ring.capacity(), 128);
+  s21::ring_buffer<int> exact(64);
+  EXPECT_EQ(exact.capacity(), 64);
+}
+
+TEST(RingBufferTest, WrapsAround) {
+  s21::ring_buffer<std::string> ring(8);
+  std::deque<std::string> expected;
+  for (int i = 0; i < 1000; ++i) {
+    ring.push_back(std::to_string(i));
+    expected.push_back(std::to_string(i));
+    if (i % 3 != 0) {
+      continue;
+    }
+    while (ring.size() > 5) {
+      ASSERT_EQ(ring.front(), expected.front());
+      ring.pop_front();
+      expected.pop_front();
+    }
+    ASSERT_EQ(ring.back(), expected.back());
+  }
+  ASSERT_EQ(ring.size(), expected.size());
+  for (std::size_t i = 0; i < ring.size(); ++i) {
+    EXPECT_EQ(ring[i], expected[i]);
+  }
+  EXPECT_THROW(ring.at(ring.size()), std::out_of_range);
+}
+
+TEST(RingBufferTest, RejectsPushWhenFull) {
+  s21::ring_buffer<int> ring(4);
+  for (int i = 0; i < 4; ++i) {
+    ring.emplace_back(i);
+  }
+  EXPECT_TRUE(ring.full());
+  EXPECT_THROW(ring.push_back(4), std::length_error);
+  EXPECT_EQ(ring.size(), 4);
+  ring.pop_back();
+  ring.push_back(9);
+  EXPECT_EQ(ring.back(), 9);
+  EXPECT_EQ(ring.front(), 0);
+}
+
+TEST(RingBufferTest, CopyMoveAndSwap) {
+  s21::ring_buffer<std::string> ring(4);
+  for (int i = 0; i < 6; ++i) {
+    ring.push_back(std::to_string(i));
+    if (ring.size() > 3) {
+      ring.pop_front();
+    }
+  }
+  s21::ring_buffer<std::string> copy(ring);
+  EXPECT_EQ(copy.capacity(), 4);
+  EXPECT_EQ(copy.front(), "3");
+  EXPECT_EQ(copy.back(), "5");
+
+  s21::ring_buffer<std::string> moved(std::move(copy));
+  EXPECT_EQ(copy.capacity(), 0);
+  EXPECT_EQ(moved.size(), 3);
+
+  s21::ring_buffer<std::string> other{"a"};
+  other = ring;
+  EXPECT_EQ(other.size(), 3);
+  EXPECT_EQ(other.capacity(), 4);
+  other.clear();
+  EXPECT_TRUE(other.empty());
+
+  other.swap(moved);
+  EXPECT_EQ(other[1], "4");
+  EXPECT_TRUE(moved.empty());
+  moved = std::move(other);
+  EXPECT_EQ(moved.back(), "5");
+}
+
+TEST(RingBufferTest, QueueBackend) {
+  using packet_queue = s21::queue<int, s21::ring_buffer<int>>;
+  packet_queue packets(s21::ring_buffer<int>(16));
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 16; ++i) {
+      packets.push(round * 16 + i);
+    }
+    EXPECT_THROW(packets.push(-1), std::length_error);
+    for (int i = 0; i < 16; ++i) {
+      ASSERT_EQ(packets.front(), round * 16 + i);
+      packets.pop();
+    }
+    EXPECT_TRUE(packets.empty());
+  }
+
+  s21::queue<int, s21::ring_buffer<int>> listed{1, 2, 3};
+  EXPECT_EQ(listed.front(), 1);
+  EXPECT_EQ(listed.back(), 3);
+}
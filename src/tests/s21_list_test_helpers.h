@@ -0,0 +1,20 @@
+#ifndef S21_LIST_TEST_HELPERS_H_
+#define S21_LIST_TEST_HELPERS_H_
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <list>
+
+namespace s21_test {
+// Checks a list-like container against std::list in both directions.
+template <typename List, typename T>
+void ExpectSame(const List &actual, const std::list<T> &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  EXPECT_TRUE(std::equal(actual.begin(), actual.end(), expected.begin()));
+  EXPECT_TRUE(std::equal(std::make_reverse_iterator(actual.end()),
+                         std::make_reverse_iterator(actual.begin()), expected.rbegin()));
+}
+}  // namespace s21_test
+
+#endif  // S21_LIST_TEST_HELPERS_H_
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "../../s21_containers.h"
+
+namespace {
+// Counts allocations so tests can check that inline storage is used
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  inline static int allocations = 0;
+
+  CountingAllocator() = default;
+  template <typename U>
+  explicit CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t count) {
+    ++allocations;
+    return std::allocator<T>().allocate(count);
+  }
+  void deallocate(T* ptr, std::size_t count) noexcept {
+    std::allocator<T>().deallocate(ptr, count);
+  }
+
+  bool operator==(const CountingAllocator&) const noexcept { return true; }
+};
+}  // namespace
+
+class SmallVectorTest : public ::testing::Test {
+ protected:
+  using small_strings = s21::small_vector<std::string, 4, CountingAllocator<std::string>>;
+
+  void SetUp() override { CountingAllocator<std::string>::allocations = 0; }
+
+  inline static const std::initializer_list<std::string> k_string_values = {"one", "two", "three"};
+};
+
+TEST_F(SmallVectorTest, InlineStorage) {
+  small_strings vect;
+  EXPECT_TRUE(vect.empty());
+  EXPECT_EQ(vect.capacity(), 4);
+
+  for (const auto &value : k_string_values) {
+    vect.push_back(value);
+  }
+  vect.emplace_back(5, 'x');
+  EXPECT_EQ(vect.size(), 4);
+  EXPECT_EQ(vect[3], "xxxxx");
+  EXPECT_EQ(CountingAllocator<std::string>::allocations, 0);
+}
+
+namespace {
+// Throws from its move constructor once armed
+struct FragileMove {
+  explicit FragileMove(int id_value) : id(id_value) {}
+  FragileMove(const FragileMove &) = default;
+  FragileMove(FragileMove &&other) : id(other.id) {
+    if (armed) {
+      throw std::runtime_error("FragileMove");
+    }
+  }
+  FragileMove &operator=(const FragileMove &) = default;
+  FragileMove &operator=(FragileMove &&) = default;
+
+  inline static bool armed = false;
+  int id;
+};
+}  // namespace
+
+TEST_F(SmallVectorTest, MoveAssignInlineElements) {
+  // Inline elements are moved one by one, so this may throw
+  static_assert(std::is_nothrow_move_assignable_v<small_strings>);
+  static_assert(!std::is_nothrow_move_assignable_v<s21::small_vector<FragileMove, 4>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::vector<FragileMove>>);
+
+  small_strings target = {"a", "b", "c", "d", "e"};
+  small_strings source(k_string_values);
+  target = std::move(source);
+  EXPECT_EQ(target.size(), 3);
+  EXPECT_EQ(target.capacity(), 4);
+  EXPECT_EQ(target[2], "three");
+  EXPECT_TRUE(source.empty());
+  source.push_back("again");
+  EXPECT_EQ(source[0], "again");
+
+  s21::small_vector<FragileMove, 4> fragile_target;
+  fragile_target.emplace_back(1);
+  s21::small_vector<FragileMove, 4> fragile_source;
+  fragile_source.emplace_back(2);
+  fragile_source.emplace_back(3);
+  FragileMove::armed = true;
+  EXPECT_THROW(fragile_target = std::move(fragile_source), std::runtime_error);
+  FragileMove::armed = false;
+  EXPECT_TRUE(fragile_target.empty());
+  ASSERT_EQ(fragile_source.size(), 2);
+  EXPECT_EQ(fragile_source[1].id, 3);
+}
+
+TEST_F(SmallVectorTest, Overflow) {
+  small_strings vect(k_string_values);
+  vect.push_back("four");
+  vect.push_back("five");
+  EXPECT_EQ(CountingAllocator<std::string>::allocations, 1);
+  EXPECT_EQ(vect.size(), 5);
+  EXPECT_GE(vect.capacity(), 5);
+  EXPECT_EQ(vect[0], "one");
+  EXPECT_EQ(vect[4], "five");
+
+  // Shrinking below N moves the elements back inline
+  vect.erase(vect.cbegin() + 2, vect.cend());
+  vect.shrink_to_fit();
+  EXPECT_EQ(vect.capacity(), 4);
+  EXPECT_EQ(vect[1], "two");
+
+  s21::small_vector<int, 2> ints(10, 7);
+  EXPECT_EQ(ints.size(), 10);
+  EXPECT_EQ(ints[9], 7);
+}
+
+TEST_F(SmallVectorTest, CopyAndMove) {
+  small_strings inline_vect(k_string_values);
+  small_strings heap_vect = {"a", "b", "c", "d", "e"};
+
+  small_strings copy(inline_vect);
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(copy[2], "three");
+
+  small_strings moved(std::move(inline_vect));
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_EQ(moved[0], "one");
+  EXPECT_TRUE(inline_vect.empty());
+
+  const std::string *heap_data = heap_vect.data();
+  small_strings moved_heap(std::move(heap_vect));
+  EXPECT_EQ(moved_heap.data(), heap_data);
+  EXPECT_EQ(moved_heap.size(), 5);
+  EXPECT_TRUE(heap_vect.empty());
+  EXPECT_EQ(heap_vect.capacity(), 4);
+
+  moved = std::move(moved_heap);
+  EXPECT_EQ(moved.size(), 5);
+  EXPECT_EQ(moved[4], "e");
+  moved_heap = std::move(copy);
+  EXPECT_EQ(moved_heap.size(), 3);
+  EXPECT_EQ(moved_heap[1], "two");
+}
+
+TEST_F(SmallVectorTest, Swap) {
+  small_strings inline_vect(k_string_values);
+  small_strings heap_vect = {"a", "b", "c", "d", "e"};
+
+  inline_vect.swap(heap_vect);
+  EXPECT_EQ(inline_vect.size(), 5);
+  EXPECT_EQ(inline_vect[4], "e");
+  EXPECT_EQ(heap_vect.size(), 3);
+  EXPECT_EQ(heap_vect[0], "one");
+
+  small_strings other = {"x"};
+  heap_vect.swap(other);
+  EXPECT_EQ(heap_vect.size(), 1);
+  EXPECT_EQ(other.size(), 3);
+  EXPECT_EQ(other[2], "three");
+}
+
+TEST_F(SmallVectorTest, CompareWithStdVector) {
+  s21::small_vector<int, 8> vect;
+  std::vector<int> std_vect;
+
+  for (int i = 0; i < 100; ++i) {
+    vect.insert(vect.cbegin() + (i / 2), i);
+    std_vect.insert(std_vect.begin() + (i / 2), i);
+    if (i % 7 == 0) {
+      vect.erase(vect.cbegin());
+      std_vect.erase(std_vect.begin());
+    }
+  }
+
+  ASSERT_EQ(vect.size(), std_vect.size());
+  for (size_t i = 0; i < vect.size(); ++i) {
+    EXPECT_EQ(vect[i], std_vect[i]);
+  }
+}
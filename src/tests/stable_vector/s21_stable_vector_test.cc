@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "../../s21_containers.h"
+
+class StableVectorTest : public ::testing::Test {
+ protected:
+  static constexpr std::size_t k_reserve = std::size_t(1) << 30;
+};
+
+TEST_F(StableVectorTest, GrowthKeepsAddresses) {
+  s21::stable_vector<long> vect{s21::address_space_allocator<long>(k_reserve)};
+
+  vect.push_back(0);
+  const long *first = &vect[0];
+  for (long i = 1; i < 1000000; ++i) {
+    vect.push_back(i);
+  }
+
+  EXPECT_EQ(&vect[0], first);
+  EXPECT_EQ(vect.size(), 1000000);
+  EXPECT_EQ(vect.capacity() * sizeof(long) % s21::address_space_allocator<long>::page_size(), 0);
+  for (long i = 0; i < 1000000; i += 997) {
+    EXPECT_EQ(vect[i], i);
+  }
+}
+
+TEST_F(StableVectorTest, InsertAndReserveKeepAddresses) {
+  s21::stable_vector<std::string> vect{s21::address_space_allocator<std::string>(k_reserve)};
+  vect.emplace_back("first");
+  const std::string *first = vect.data();
+
+  vect.reserve(100000);
+  vect.insert(vect.cend(), 5000, "x");
+  vect.insert_many(vect.cbegin() + 1, "a", "b");
+  vect.resize(200000);
+  EXPECT_EQ(vect.data(), first);
+  EXPECT_EQ(vect[0], "first");
+  EXPECT_EQ(vect[2], "b");
+  EXPECT_EQ(vect[5002], "x");
+
+  vect.resize(10);
+  vect.shrink_to_fit();
+  EXPECT_EQ(vect.data(), first);
+  EXPECT_EQ(vect.capacity(), 10);
+  vect.push_back("again");
+  EXPECT_EQ(vect.back(), "again");
+}
+
+TEST_F(StableVectorTest, ReservationLimit) {
+  s21::stable_vector<int> vect{s21::address_space_allocator<int>(1 << 16)};
+  EXPECT_EQ(vect.max_size(), (1 << 16) / sizeof(int));
+
+  vect.resize(vect.max_size());
+  EXPECT_THROW(vect.push_back(1), std::length_error);
+  EXPECT_EQ(vect.size(), vect.max_size());
+}
+
+TEST_F(StableVectorTest, GrowthStopsAtReservation) {
+  // 196608 ints: doubling from 131072 would overshoot the reservation
+  s21::stable_vector<int> vect{s21::address_space_allocator<int>(768 << 10)};
+  const std::size_t limit = vect.max_size();
+  EXPECT_EQ(limit, 196608);
+
+  for (std::size_t i = 0; i < limit; ++i) {
+    vect.push_back(static_cast<int>(i));
+  }
+  EXPECT_EQ(vect.size(), limit);
+  EXPECT_EQ(vect.capacity(), limit);
+  EXPECT_EQ(vect.back(), static_cast<int>(limit - 1));
+  EXPECT_THROW(vect.push_back(0), std::length_error);
+  EXPECT_THROW(vect.insert(vect.cbegin(), 2, 0), std::length_error);
+  EXPECT_EQ(vect.size(), limit);
+}
+
+TEST_F(StableVectorTest, ConstructorThrowsPastReservation) {
+  EXPECT_THROW((s21::stable_vector<int>(100000, 0, s21::address_space_allocator<int>(1 << 16))),
+               std::length_error);
+}
+
+TEST_F(StableVectorTest, SwapExchangesReservations) {
+  s21::stable_vector<int> small{s21::address_space_allocator<int>(1 << 16)};
+  s21::stable_vector<int> large{s21::address_space_allocator<int>(k_reserve)};
+  small.push_back(1);
+  large.push_back(2);
+
+  small.swap(large);
+  EXPECT_EQ(small.max_size(), k_reserve / sizeof(int));
+  EXPECT_EQ(large.max_size(), (1 << 16) / sizeof(int));
+  EXPECT_EQ(small[0], 2);
+  EXPECT_EQ(large[0], 1);
+
+  for (int i = 0; i < 100000; ++i) {
+    small.push_back(i);
+  }
+  large.resize(large.max_size());
+  EXPECT_THROW(large.push_back(0), std::length_error);
+  EXPECT_EQ(small.size(), 100001);
+}
+
+TEST_F(StableVectorTest, MoveAndSwap) {
+  s21::stable_vector<int> vect1{s21::address_space_allocator<int>(k_reserve)};
+  s21::stable_vector<int> vect2{s21::address_space_allocator<int>(k_reserve)};
+  vect1.assign({1, 2, 3});
+  vect2.push_back(4);
+
+  const int *data1 = vect1.data();
+  vect1.swap(vect2);
+  EXPECT_EQ(vect2.data(), data1);
+  EXPECT_EQ(vect1[0], 4);
+
+  s21::stable_vector<int> moved(std::move(vect2));
+  EXPECT_EQ(moved.data(), data1);
+  EXPECT_EQ(moved.size(), 3);
+}
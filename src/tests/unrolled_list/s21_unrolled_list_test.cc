@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../../s21_containers.h"
+#include "../s21_list_test_helpers.h"
+
+using s21_test::ExpectSame;
+
+namespace {
+int unrolled_allocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t count) {
+    ++unrolled_allocations;
+    return std::allocator<T>().allocate(count);
+  }
+  void deallocate(T* ptr, std::size_t count) noexcept {
+    std::allocator<T>().deallocate(ptr, count);
+  }
+  template <typename U>
+  bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+};
+}  // namespace
+
+TEST(UnrolledListTest, PushPopAndAccess) {
+  s21::unrolled_list<int, 4> values;
+  std::list<int> expected;
+  for (int i = 0; i < 10; ++i) {
+    values.push_back(i);
+    expected.push_back(i);
+    values.push_front(-i);
+    expected.push_front(-i);
+  }
+  ExpectSame(values, expected);
+  EXPECT_EQ(values.front(), -9);
+  EXPECT_EQ(values.back(), 9);
+
+  values.pop_back();
+  values.pop_front();
+  expected.pop_back();
+  expected.pop_front();
+  ExpectSame(values, expected);
+
+  values.clear();
+  EXPECT_TRUE(values.empty());
+  EXPECT_EQ(values.begin(), values.end());
+}
+
+TEST(UnrolledListTest, RandomInsertAndErase) {
+  s21::unrolled_list<int, 4> values;
+  std::list<int> expected;
+  std::mt19937 random(42);
+
+  for (int step = 0; step < 4000; ++step) {
+    std::size_t offset = expected.empty() ? 0 : random() % (expected.size() + 1);
+    auto iter = std::next(values.begin(), offset);
+    auto expected_iter = std::next(expected.begin(), offset);
+    if (random() % 3 != 0 || expected_iter == expected.end()) {
+      auto inserted = values.insert(iter, step);
+      expected.insert(expected_iter, step);
+      ASSERT_EQ(*inserted, step);
+    } else {
+      auto next = values.erase(iter);
+      auto expected_next = expected.erase(expected_iter);
+      ASSERT_EQ(next == values.end(), expected_next == expected.end());
+      if (next != values.end()) {
+        ASSERT_EQ(*next, *expected_next);
+      }
+    }
+  }
+  ExpectSame(values, expected);
+
+  auto first = std::next(values.begin(), 10);
+  auto last = std::next(first, 500);
+  auto after = values.erase(first, last);
+  expected.erase(std::next(expected.begin(), 10), std::next(expected.begin(), 510));
+  EXPECT_EQ(*after, *std::next(expected.begin(), 10));
+  ExpectSame(values, expected);
+}
+
+TEST(UnrolledListTest, ConstructAndAssign) {
+  std::vector<std::string> source{"a", "b", "c", "d", "e"};
+  s21::unrolled_list<std::string, 2> strings(source.begin(), source.end());
+  ExpectSame(strings, std::list<std::string>(source.begin(), source.end()));
+
+  s21::unrolled_list<std::string, 2> copy(strings);
+  s21::unrolled_list<std::string, 2> moved(std::move(strings));
+  EXPECT_TRUE(strings.empty());
+  ExpectSame(moved, std::list<std::string>(source.begin(), source.end()));
+
+  strings = copy;
+  copy = std::move(moved);
+  EXPECT_EQ(strings.size(), 5);
+  EXPECT_EQ(copy.back(), "e");
+
+  s21::unrolled_list<int, 4> counted(10, 7);
+  EXPECT_EQ(counted.size(), 10);
+  EXPECT_EQ(std::count(counted.begin(), counted.end(), 7), 10);
+}
+
+TEST(UnrolledListTest, EmplaceMoveOnly) {
+  s21::unrolled_list<std::unique_ptr<int>, 2> owned;
+  owned.emplace_back(new int(3));
+  owned.emplace_front(new int(1));
+  owned.emplace(std::next(owned.cbegin()), new int(2));
+  auto last = owned.insert_many(owned.cend(), std::make_unique<int>(4), std::make_unique<int>(5));
+  EXPECT_EQ(**last, 5);
+
+  int expected = 1;
+  for (const auto &value : owned) {
+    EXPECT_EQ(*value, expected++);
+  }
+  owned.sort([](const auto &lhs, const auto &rhs) { return *lhs > *rhs; });
+  EXPECT_EQ(*owned.front(), 5);
+  EXPECT_EQ(*owned.back(), 1);
+}
+
+TEST(UnrolledListTest, SpliceMergeSort) {
+  s21::unrolled_list<int, 4> values{1, 2, 3, 4, 5, 6, 7};
+  s21::unrolled_list<int, 4> other{10, 11, 12};
+  std::list<int> expected{1, 2, 3, 4, 5, 6, 7};
+  std::list<int> expected_other{10, 11, 12};
+
+  values.splice(std::next(values.cbegin(), 2), other);
+  expected.splice(std::next(expected.cbegin(), 2), expected_other);
+  EXPECT_TRUE(other.empty());
+  ExpectSame(values, expected);
+
+  values.splice(values.cbegin(), values, std::next(values.cbegin(), 5), std::next(values.cbegin(), 8));
+  expected.splice(expected.cbegin(), expected, std::next(expected.cbegin(), 5), std::next(expected.cbegin(), 8));
+  ExpectSame(values, expected);
+
+  values.splice(values.cend(), values, values.cbegin());
+  expected.splice(expected.cend(), expected, expected.cbegin());
+  ExpectSame(values, expected);
+
+  values.sort();
+  expected.sort();
+  ExpectSame(values, expected);
+
+  s21::unrolled_list<int, 4> odds{1, 3, 5, 7, 9, 11};
+  std::list<int> expected_odds{1, 3, 5, 7, 9, 11};
+  values.merge(odds);
+  expected.merge(expected_odds);
+  EXPECT_TRUE(odds.empty());
+  ExpectSame(values, expected);
+
+  values.unique();
+  expected.unique();
+  ExpectSame(values, expected);
+
+  values.reverse();
+  expected.reverse();
+  ExpectSame(values, expected);
+}
+
+TEST(UnrolledListTest, SortIsStable) {
+  s21::unrolled_list<std::pair<int, int>, 8> pairs;
+  std::list<std::pair<int, int>> expected;
+  for (int i = 0; i < 500; ++i) {
+    pairs.emplace_back(i % 7, i);
+    expected.emplace_back(i % 7, i);
+  }
+  auto by_key = [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; };
+  pairs.sort(by_key);
+  expected.sort(by_key);
+  ExpectSame(pairs, expected);
+}
+
+TEST(UnrolledListTest, SortBufferUsesListAllocator) {
+  s21::unrolled_list<int, 4, CountingAllocator<int>> values{5, 3, 9, 1, 7, 2};
+  int before = unrolled_allocations;
+  values.sort();
+  EXPECT_GT(unrolled_allocations, before);
+  ExpectSame(values, std::list<int>{1, 2, 3, 5, 7, 9});
+}
+
+TEST(UnrolledListTest, MergeKeepsValuesWhenCompareThrows) {
+  s21::unrolled_list<std::string, 2> values{"a", "c", "e", "g"};
+  s21::unrolled_list<std::string, 2> other{"b", "d", "f"};
+  int calls = 0;
+  auto throwing_less = [&calls](const std::string &lhs, const std::string &rhs) {
+    if (++calls == 4) {
+      throw std::runtime_error("compare");
+    }
+    return lhs < rhs;
+  };
+  EXPECT_THROW(values.merge(other, throwing_less), std::runtime_error);
+
+  std::vector<std::string> all(values.begin(), values.end());
+  all.insert(all.end(), other.begin(), other.end());
+  std::sort(all.begin(), all.end());
+  EXPECT_EQ(all, (std::vector<std::string>{"a", "b", "c", "d", "e", "f", "g"}));
+  EXPECT_EQ(values.size() + other.size(), 7);
+}
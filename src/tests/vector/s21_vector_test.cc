@@ -1,8 +1,29 @@
 #include <gtest/gtest.h>
 #include <vector>
+#include <sstream>
 #include <string>
 #include "../../s21_containers.h"
 
+namespace {
+struct PodRecord {
+  long id;
+  double values[4];
+};
+
+struct alignas(64) OverAlignedRecord {
+  int id;
+};
+
+// Owns a heap buffer but has no self-references, so it may be moved bitwise
+struct OwningRecord {
+  std::unique_ptr<int> value;
+  explicit OwningRecord(int val) : value(std::make_unique<int>(val)) {}
+};
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<OwningRecord> : std::true_type {};
+
 // Test fixture for s21::vector testing
 class VectorTest : public ::testing::Test {
  protected:
@@ -475,6 +496,74 @@ TEST_F(VectorTest, PushBackMethod) {
   EXPECT_EQ(vect2[2], 3);
 }
 
+TEST_F(VectorTest, PushBackRvalueMethod) {
+  s21::vector<std::string> vect;
+  std::string value(64, 'x');
+
+  vect.push_back(std::move(value));
+  EXPECT_EQ(vect.size(), 1);
+  EXPECT_EQ(vect[0], std::string(64, 'x'));
+  EXPECT_TRUE(value.empty()); // Moved-from, not copied
+
+  // Pushing an own element while the storage is full must not read freed memory
+  s21::vector<std::string> vect2 = {"first"};
+  vect2.shrink_to_fit();
+  vect2.push_back(vect2[0]);
+  EXPECT_EQ(vect2.size(), 2);
+  EXPECT_EQ(vect2[1], "first");
+}
+
+TEST_F(VectorTest, EmplaceBackMethod) {
+  s21::vector<std::pair<int, std::string>> vect;
+
+  auto &ref = vect.emplace_back(1, "one");
+  EXPECT_EQ(ref.first, 1);
+  vect.emplace_back(2, "two");
+  vect.emplace_back(3, std::string(5, 'c'));
+  EXPECT_EQ(vect.size(), 3);
+  EXPECT_EQ(vect[1].second, "two");
+  EXPECT_EQ(vect[2].second, "ccccc");
+
+  // Move-only types can be stored
+  s21::vector<std::unique_ptr<int>> ptrs;
+  for (int i = 0; i < 10; ++i) {
+    ptrs.emplace_back(std::make_unique<int>(i));
+  }
+  ptrs.push_back(std::make_unique<int>(10));
+  EXPECT_EQ(ptrs.size(), 11);
+  for (int i = 0; i < 11; ++i) {
+    EXPECT_EQ(*ptrs[i], i);
+  }
+}
+
+TEST_F(VectorTest, EmplaceMethod) {
+  s21::vector<std::string> vect(k_string_values);
+  vect.shrink_to_fit();
+
+  // Emplace with reallocation
+  auto iter = vect.emplace(vect.cbegin() + 2, 3, 'a');
+  EXPECT_EQ(*iter, "aaa");
+  EXPECT_EQ(vect.size(), 6);
+  EXPECT_EQ(vect[1], "two");
+  EXPECT_EQ(vect[3], "three");
+
+  // Emplace without reallocation, argument aliases a shifted element
+  vect.reserve(10);
+  iter = vect.emplace(vect.cbegin(), vect[5]);
+  EXPECT_EQ(*iter, "five");
+  EXPECT_EQ(vect[6], "five");
+
+  // Emplace at the end
+  iter = vect.emplace(vect.cend(), "end");
+  EXPECT_EQ(vect.back(), "end");
+  EXPECT_EQ(vect.size(), 8);
+
+  std::string moved = "moved";
+  vect.insert(vect.cbegin() + 1, std::move(moved));
+  EXPECT_EQ(vect[1], "moved");
+  EXPECT_TRUE(moved.empty());
+}
+
 TEST_F(VectorTest, PopBackMethod) {
   s21::vector<int> vect(k_int_values);
   size_t original_size = vect.size();
@@ -578,4 +667,218 @@ TEST_F(VectorTest, LargeVector) {
   vect.clear();
   EXPECT_EQ(vect.size(), 0);
   EXPECT_GE(vect.capacity(), k_large_size);
-}
\ No newline at end of file
+}
+
+TEST_F(VectorTest, TriviallyRelocatableTrait) {
+  EXPECT_TRUE(s21::is_trivially_relocatable_v<int>);
+  EXPECT_TRUE(s21::is_trivially_relocatable_v<PodRecord>);
+  EXPECT_TRUE(s21::is_trivially_relocatable_v<OwningRecord>);
+  EXPECT_FALSE(s21::is_trivially_relocatable_v<std::string>);
+}
+
+TEST_F(VectorTest, RelocatableGrowth) {
+  s21::vector<PodRecord> pods;
+  s21::vector<OverAlignedRecord> aligned;
+  s21::vector<OwningRecord> owning;
+
+  for (int i = 0; i < 1000; ++i) {
+    pods.push_back({i, {1.0 * i, 2.0, 3.0, 4.0}});
+    aligned.push_back({i});
+    owning.emplace_back(i);
+  }
+  pods.emplace(pods.cbegin() + 10, PodRecord{-1, {}});
+  aligned.insert(aligned.cbegin() + 10, {-1});
+  owning.emplace(owning.cbegin() + 10, -1);
+  pods.reserve(5000);
+  owning.shrink_to_fit();
+
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned.data()) % 64, 0);
+  ASSERT_EQ(owning.size(), 1001);
+  for (int i = 0; i < 1001; ++i) {
+    int expected = i < 10 ? i : (i == 10 ? -1 : i - 1);
+    EXPECT_EQ(pods[i].id, expected);
+    EXPECT_EQ(aligned[i].id, expected);
+    EXPECT_EQ(*owning[i].value, expected);
+  }
+}
+
+TEST_F(VectorTest, GrowthPolicies) {
+  EXPECT_EQ(s21::growth::factor_2::next_capacity(0, 4), 1);
+  EXPECT_EQ(s21::growth::factor_2::next_capacity(8, 4), 16);
+  EXPECT_EQ(s21::growth::factor_1_5::next_capacity(1, 4), 2);
+  EXPECT_EQ(s21::growth::factor_1_5::next_capacity(8, 4), 12);
+  EXPECT_EQ(s21::growth::page_rounded<>::next_capacity(1, 4), 1024);
+  EXPECT_EQ(s21::growth::page_rounded<>::next_capacity(1024, 4), 2048);
+  EXPECT_EQ((s21::growth::capped_linear<64, 32>::next_capacity(8, 4)), 16);
+  EXPECT_EQ((s21::growth::capped_linear<64, 32>::next_capacity(16, 4)), 24);
+}
+
+TEST_F(VectorTest, GrowthPolicyParameter) {
+  s21::vector<int, std::allocator<int>, s21::growth::factor_1_5> vect;
+  s21::vector<int, std::allocator<int>, s21::growth::page_rounded<>> paged;
+  s21::vector<int, std::allocator<int>, s21::growth::capped_linear<64, 32>> capped;
+  std::vector<size_t> capacities;
+
+  for (int i = 0; i < 20; ++i) {
+    if (vect.capacity() == vect.size()) {
+      capacities.push_back(vect.capacity());
+    }
+    vect.push_back(i);
+    paged.push_back(i);
+    capped.insert(capped.cend(), i);
+  }
+
+  EXPECT_EQ(capacities, std::vector<size_t>({0, 1, 2, 3, 4, 6, 9, 13, 19}));
+  EXPECT_EQ(paged.capacity(), 1024);
+  EXPECT_EQ(capped.capacity(), 24);
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(vect[i], i);
+    EXPECT_EQ(capped[i], i);
+  }
+}
+
+TEST_F(VectorTest, ResizeMethod) {
+  s21::vector<std::string> vect(k_string_values);
+
+  vect.resize(3);
+  EXPECT_EQ(vect.size(), 3);
+  EXPECT_EQ(vect.back(), "three");
+
+  vect.resize(20);
+  EXPECT_EQ(vect.size(), 20);
+  EXPECT_EQ(vect.capacity(), 20); // Single allocation sized by the growth policy
+  EXPECT_EQ(vect[1], "two");
+  EXPECT_TRUE(vect[19].empty());
+
+  vect.resize(45, vect[0]);
+  EXPECT_EQ(vect.size(), 45);
+  EXPECT_EQ(vect.capacity(), 45);
+  EXPECT_EQ(vect[44], "one");
+
+  vect.resize(1, "unused");
+  EXPECT_EQ(vect.size(), 1);
+  EXPECT_EQ(vect[0], "one");
+}
+
+TEST_F(VectorTest, AssignMethod) {
+  s21::vector<std::string> vect(k_string_values);
+
+  vect.assign(2, "x");
+  EXPECT_EQ(vect.size(), 2);
+  EXPECT_EQ(vect[1], "x");
+
+  vect.assign(4, vect[0]);
+  EXPECT_EQ(vect.size(), 4);
+  EXPECT_EQ(vect[3], "x");
+
+  vect.assign(10, "y");
+  EXPECT_EQ(vect.size(), 10);
+  EXPECT_EQ(vect.capacity(), 10);
+
+  std::vector<std::string> source = {"a", "b", "c"};
+  vect.assign(source.begin(), source.end());
+  EXPECT_EQ(vect.size(), 3);
+  EXPECT_EQ(vect[2], "c");
+
+  vect.assign({"d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n"});
+  EXPECT_EQ(vect.size(), 11);
+  EXPECT_EQ(vect.front(), "d");
+  EXPECT_EQ(vect.back(), "n");
+
+  std::istringstream stream("1 2 3");
+  s21::vector<int> ints = {9};
+  ints.assign(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+  EXPECT_EQ(ints.size(), 3);
+  EXPECT_EQ(ints[2], 3);
+
+  s21::vector<int> from_range(k_int_values.begin(), k_int_values.end());
+  EXPECT_EQ(from_range.size(), k_int_values.size());
+  EXPECT_EQ(from_range[4], 5);
+}
+
+TEST_F(VectorTest, RangeInsertMethod) {
+  s21::vector<int> vect(k_int_values);
+  std::vector<int> std_vect(k_int_values);
+  std::vector<int> source(100);
+  for (int i = 0; i < 100; ++i) {
+    source[i] = 100 + i;
+  }
+
+  // Reallocating insert allocates once
+  auto iter = vect.insert(vect.cbegin() + 2, source.begin(), source.end());
+  std_vect.insert(std_vect.begin() + 2, source.begin(), source.end());
+  EXPECT_EQ(*iter, 100);
+  EXPECT_EQ(vect.capacity(), 105);
+
+  // Insert within capacity
+  vect.reserve(200);
+  vect.insert(vect.cbegin() + 50, 3, vect[0]);
+  std_vect.insert(std_vect.begin() + 50, 3, std_vect[0]);
+  vect.insert(vect.cend(), {7, 8, 9});
+  std_vect.insert(std_vect.end(), {7, 8, 9});
+  vect.insert(vect.cbegin(), source.begin(), source.begin());
+  s21::vector<int> other = {-1, -2};
+  vect.insert(vect.cbegin() + 4, other.begin(), other.end());
+  std_vect.insert(std_vect.begin() + 4, {-1, -2});
+
+  std::istringstream stream("1 2 3");
+  vect.insert(vect.cbegin() + 1, std::istream_iterator<int>(stream), std::istream_iterator<int>());
+  std_vect.insert(std_vect.begin() + 1, {1, 2, 3});
+
+  ASSERT_EQ(vect.size(), std_vect.size());
+  for (size_t i = 0; i < vect.size(); ++i) {
+    EXPECT_EQ(vect[i], std_vect[i]);
+  }
+}
+
+TEST_F(VectorTest, InsertManyMethod) {
+  s21::vector<std::string> vect(k_string_values);
+  vect.shrink_to_fit();
+
+  auto iter = vect.insert_many(vect.cbegin() + 1, "a", std::string("b"), vect[4]);
+  EXPECT_EQ(*iter, "a");
+  EXPECT_EQ(vect.size(), 8);
+  EXPECT_EQ(vect.capacity(), 10);
+  EXPECT_EQ(vect[2], "b");
+  EXPECT_EQ(vect[3], "five");
+  EXPECT_EQ(vect[4], "two");
+
+  // Arguments may alias elements that get shifted
+  vect.insert_many(vect.cbegin(), vect[7], vect[6]);
+  EXPECT_EQ(vect[0], "five");
+  EXPECT_EQ(vect[1], "four");
+  EXPECT_EQ(vect.size(), 10);
+
+  vect.insert_many_back("x", "y");
+  EXPECT_EQ(vect.size(), 12);
+  EXPECT_EQ(vect[10], "x");
+  EXPECT_EQ(vect.back(), "y");
+
+  vect.insert_many_back();
+  EXPECT_EQ(vect.size(), 12);
+}
+
+TEST_F(VectorTest, DefaultInitConstructor) {
+  s21::vector<PodRecord> records(16, s21::default_init);
+  EXPECT_EQ(records.size(), 16);
+  EXPECT_EQ(records.capacity(), 16);
+
+  s21::vector<std::string> strings(3, s21::default_init);
+  EXPECT_EQ(strings.size(), 3);
+  EXPECT_TRUE(strings[2].empty());
+}
+
+TEST_F(VectorTest, ResizeUninitializedMethod) {
+  s21::vector<char> buffer = {'a', 'b'};
+
+  buffer.resize_uninitialized(1 << 16);
+  EXPECT_EQ(buffer.size(), 1 << 16);
+  EXPECT_EQ(buffer[0], 'a');
+  EXPECT_EQ(buffer[1], 'b');
+  buffer[(1 << 16) - 1] = 'z';
+
+  buffer.resize_uninitialized(1);
+  EXPECT_EQ(buffer.size(), 1);
+  EXPECT_GE(buffer.capacity(), 1 << 16);
+  EXPECT_EQ(buffer.back(), 'a');
+}